@@ -27,6 +27,7 @@
 #define ARITHMOS_IO_MPIEEE_HEXREP       0x00000010
 #define ARITHMOS_IO_MPIEEE_FLAGS        0x00000020
 #define ARITHMOS_IO_MPIEEE_RATIONAL     0x00000040
+#define ARITHMOS_IO_MPIEEE_SHORTEST     0x00200000
 
 #define ARITHMOS_IO_IMPIEEE_PARAM       0x00000080
 #define ARITHMOS_IO_IMPIEEE_DECIMAL     0x00000100
@@ -48,6 +48,19 @@
 #define ULLONG_MAX (~(ULONGLONG)0)
 #endif
 
+/*
+ * Move constructors and move assignments need C++11 rvalue
+ * references.  Without them, TmpBigInt still takes care of
+ * temporaries.
+ */
+#if !defined(ARITHMOS_RVALUE_REFS) && (__cplusplus >= 201103L || \
+    (defined(_MSC_VER) && _MSC_VER >= 1600))
+#define ARITHMOS_RVALUE_REFS
+#endif
+#ifdef ARITHMOS_RVALUE_REFS
+#include <utility>
+#endif
+
 #define LIMB_MAX (~(mp_limb_t)0)  ///< max. value of a (gnu) mp limb
 #define LIMB_BITS nBits( LIMB_MAX ) ///< no. of bits in a (gnu) mp limb
 
@@ -80,6 +93,7 @@ class MpIeee;
 class BigInt : public ControlStatus
 {
   friend class Rational;
+  friend class MpBinarySplit;
 
   public:
       /**
@@ -99,6 +113,9 @@ class BigInt : public ControlStatus
       BigInt( const BigInt& b );
       BigInt( const TmpBigInt& t );
       BigInt( const MpIeee& m );
+#ifdef ARITHMOS_RVALUE_REFS
+      BigInt( BigInt&& b );
+#endif
       /*@}*/
 
       ~BigInt();
@@ -118,6 +135,9 @@ class BigInt : public ControlStatus
       BigInt& operator=( const BigInt& b );
       BigInt& operator=( const TmpBigInt& t );
       BigInt& operator=( const MpIeee& m );
+#ifdef ARITHMOS_RVALUE_REFS
+      BigInt& operator=( BigInt&& b );
+#endif
       /*@}*/
 
       /**
@@ -187,10 +207,15 @@ class BigInt : public ControlStatus
       friend TmpBigInt operator-( const TmpBigInt& a, const TmpBigInt& b );
       BigInt& operator*=( const BigInt& b );
       friend TmpBigInt operator*( const BigInt& a, const BigInt& b );
+      friend TmpBigInt operator*( const TmpBigInt& a, const BigInt& b );
+      friend TmpBigInt operator*( const BigInt& a, const TmpBigInt& b );
+      friend TmpBigInt operator*( const TmpBigInt& a, const TmpBigInt& b );
       BigInt& operator/=( const BigInt& b );
       friend TmpBigInt operator/( const BigInt& a, const BigInt& b );
+      friend TmpBigInt operator/( const TmpBigInt& a, const BigInt& b );
       BigInt& operator%=( const BigInt& b );
       friend TmpBigInt operator%( const BigInt& a, const BigInt& b );
+      friend TmpBigInt operator%( const TmpBigInt& a, const BigInt& b );
 
       TmpBigInt inv() const;
       TmpBigInt sqrt() const;
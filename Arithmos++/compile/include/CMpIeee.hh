@@ -43,6 +43,9 @@ public:
   /*@{*/
   CMpIeee ( const CMpIeee &y ); // verbatim copy
   CMpIeee ( const TmpCMpIeee &t ); // assumption initializer
+#ifdef ARITHMOS_RVALUE_REFS
+  CMpIeee ( CMpIeee &&y ); // move constructor
+#endif
   /*@}*/
   
   // destructor
@@ -54,6 +57,9 @@ public:
   /*@{*/
   void operator = ( const CMpIeee& y ); // verbatim assignment
   void operator = ( const TmpCMpIeee& t ); // copy-by-assumption
+#ifdef ARITHMOS_RVALUE_REFS
+  void operator = ( CMpIeee&& y ); // move assignment
+#endif
   /*@}*/
   
   /**
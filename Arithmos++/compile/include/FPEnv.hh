@@ -33,6 +33,7 @@
 #include <limits.h>
 #include <stdlib.h>
 #include <math.h>
+#include <MpThreads.hh>
 
 /**
  ** MpIeee floating-point environment
@@ -82,19 +83,36 @@ typedef enum    FP_Rnd {
 // #define MAX_BITS 24
 // #define MAX_RADIX 4096 // Maximum Radix is 2^12 for IEEE single
 
+#ifndef ARITHMOS_LIMB_DIGITS
 typedef double Digit;		///< Type to store digits
+typedef double DoubleDigit;	///< Type to store a product of two digits
 #define MAX_BITS 53		///< Max. bits that can be stored in a Digit
 #define MAX_RADIX 16777216      ///< Maximum Radix is 2^24 for IEEE double
+#endif
 
 // typedef long double Digit;
 // #define MAX_BITS 113
 // #define MAX_RADIX pow(2,50)  // Maximum Radix is 2^50 for SUN quadruple
 
-// #define INTTYPE
-// typedef long long int Digit;
-// #define MAX_BITS 63
-// #define MAX_RADIX 2147483647 // Maximum Radix 2^31 for 64-bit signed 
-//                              // integer arithmetic
+/*
+ * Integer limb backend, selected by compiling with
+ * -DARITHMOS_LIMB_DIGITS.  The digits are stored in 32-bit unsigned
+ * limbs in radix 2^31, so that the radix itself still fits in a
+ * Digit.  A product of two digits, plus two more digits, is computed
+ * exactly in a 64-bit DoubleDigit, so all digit arithmetic is done
+ * with integer multiply and add-with-carry (see MpDigits.hh).
+ */
+#ifdef ARITHMOS_LIMB_DIGITS
+#define INTTYPE
+typedef unsigned int Digit;	///< Type to store digits
+#ifndef _WINDOWS_MSVC_
+typedef unsigned long long DoubleDigit; ///< Type to store a digit product
+#else
+typedef unsigned __int64 DoubleDigit;   ///< Type to store a digit product
+#endif
+#define MAX_BITS 32		///< Max. bits that can be stored in a Digit
+#define MAX_RADIX 2147483648U	///< Maximum Radix is 2^31 for 32-bit limbs
+#endif
 /*@}*/
 
 /// MpIeee floating-point environment
@@ -183,6 +201,137 @@ private:
   friend class MpIeee;
 };
 
+/*
+ * Thread-local storage for the environments, see ThreadFPEnv.  C++11
+ * thread_local objects can have a constructor, the older compiler
+ * extensions only hold plain data, so there the environment is built
+ * in place in thread-local bytes.  An FPEnv is plain data and needs no
+ * destructor at thread exit.  Define ARITHMOS_NO_THREADS to share a
+ * single environment, as before.
+ */
+#ifndef ARITHMOS_NO_THREADS
+#if __cplusplus >= 201103L
+#define FPENV_TLS_OBJECT
+#elif defined(__GNUC__)
+#define FPENV_TLS_POINTER __thread
+#elif defined(_WINDOWS_MSVC_)
+#define FPENV_TLS_POINTER __declspec(thread)
+#endif
+#endif
+
+#ifdef FPENV_TLS_POINTER
+#include <new>
+#endif
+
+/// Floating-point environment of the calling thread
+/**
+ ** MpIeee::fpEnv is a ThreadFPEnv: it has the interface of FPEnv, but
+ ** every call goes to the environment of the calling thread.
+ **
+ ** Every thread has an environment of its own, made on its first use
+ ** as a copy of the default environment, so the rounding mode, the
+ ** exception flags and the other settings of one thread never reach
+ ** another.  Use setDefault() before starting threads to give them
+ ** settings other than those of FPEnv().  MpParallel hands the
+ ** environment of the caller to its worker threads.
+ **
+ ** Only the default environment is guarded by a mutex, taken when a
+ ** thread makes its copy; the calls on the environment of a thread
+ ** take no lock.
+ **/
+class ThreadFPEnv {
+
+public:
+  /**
+   ** @name	Environment of the calling thread
+   **/
+  /*@{*/
+  static FPEnv& current();          ///< environment of this thread
+  static FPEnv snapshot();          ///< copy of current()
+  static void restore( const FPEnv& env ); ///< current() = env
+  /*@}*/
+
+  /**
+   ** @name	Default environment
+   **
+   ** The environment a thread starts with.
+   **/
+  /*@{*/
+  static FPEnv getDefault();
+  static void setDefault( const FPEnv& env );
+  /*@}*/
+
+  /**
+   ** @name	FPEnv interface
+   ** @see	FPEnv
+   **
+   ** These functions operate on current().
+   **/
+  /*@{*/
+  void setRound(FP_Rnd rounding);
+  FP_Rnd getRound(void) const;
+  void switchRound(void);
+
+  FP_Excep getMask(void) const;
+  void setMask(FP_Excep mask);
+
+  void signalExcep (FP_Excep e);
+  void setExcep(FP_Excep e);
+  FP_Excep getExcep(void) const;
+  void clearExcep(void);
+
+  void setRadix(Digit newRadix);
+  void setPrecision(unsigned int newPrec);
+  void setExpRange(int newL, int newU);
+  void setExpSize(int expSize);
+
+  Digit getRadix() const;
+  unsigned int getPrecision() const;
+  int getGlobalL() const;
+  int getGlobalU() const;
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  static FPEnv& defaultEnv();
+  static MpMutex& defaultLock();
+};
+
+/// Restores the environment of the calling thread on destruction
+/**
+ ** Saves the environment of the calling thread when it is created and
+ ** restores it, including the exception flags, when it goes out of
+ ** scope:
+ **
+ **	{
+ **	  FPEnvGuard guard;
+ **	  MpIeee::fpEnv.setRound( FP_RZ );
+ **	  ...
+ **	}
+ **
+ ** The changes do not reach other threads, which have environments
+ ** of their own.
+ **/
+class FPEnvGuard {
+
+public:
+  FPEnvGuard();
+  ~FPEnvGuard();
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  FPEnv saved;
+
+  FPEnvGuard( const FPEnvGuard& );              // not copyable
+  FPEnvGuard& operator=( const FPEnvGuard& );
+};
+
 #ifndef OUTLINE
 #include "FPEnv.icc"
 #endif
@@ -83,12 +83,18 @@ public:
   IMpIeee( const IMpIeee& R );
   IMpIeee( TmpIMpIeee& T );
   IMpIeee( SpecialValue s );
+#ifdef ARITHMOS_RVALUE_REFS
+  IMpIeee( IMpIeee&& R );
+#endif
   /*@}*/
 
   ~IMpIeee( );
 
   void operator= ( const IMpIeee& R );
   void operator= ( TmpIMpIeee& T );
+#ifdef ARITHMOS_RVALUE_REFS
+  void operator= ( IMpIeee&& R );
+#endif
 
   /**
    ** @name Properties of the interval.
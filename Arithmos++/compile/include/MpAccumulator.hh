@@ -0,0 +1,174 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpAccumulator : Exact accumulation of MpIeee sums and dot products
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpAccumulator.hh
+ ** @brief    Exact accumulation of MpIeee sums and dot products
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** A MpAccumulator is a long fixed-point register (Kulisch
+ ** accumulator) that holds every digit of the terms added into it.
+ ** Addends and products are added into it without any rounding; the
+ ** sum is rounded once, when it is read.  Unlike MpFusedSum, the terms
+ ** are not kept, so it can take any number of them, however far apart
+ ** their exponents are.
+ **/
+
+/*
+ * Some notes on the register.
+ *
+ * A register covering a whole format is 2U - 2L + 2p digits long,
+ * far too many for the default exponent range.  The register is a
+ * window instead, that covers only the digits of the terms added so
+ * far, plus guard digits on top of them for the carries: digit j has
+ * weight radix^(top-j), 0 <= j < width.  A term outside the window
+ * makes it grow, by at least its old width, so that terms with
+ * exponents walking away in one direction only copy the register a
+ * logarithmic number of times.  Its size follows the spread of the
+ * exponents actually added, at most twice it, not that of a format;
+ * a term that would need more than UINT_MAX digits is refused with
+ * PrecisionMismatch(), like a factor of too many digits.
+ *
+ * As in MpFusedSum, the positive and the negative terms go into two
+ * registers of nonnegative digits, subtracted only when the sum is
+ * read.  Adding a term is then one shifted MpDigits::add and a short
+ * carry; only the range of digits touched so far is looked at when
+ * the register is read, cleared or moved.
+ */
+
+/*
+ * MpIeee.hh includes this file itself, through MpFused.hh, so it has
+ * to come before the guard.
+ */
+#include <MpIeee.hh>
+
+#ifndef _ARITHMOS_MPACCUMULATOR_H_
+#define _ARITHMOS_MPACCUMULATOR_H_
+
+/**
+ ** @brief   bits of carry room on top of the register
+ ** @remark  The sum is exact for up to 2^MPACC_GUARD_BITS terms.
+ **/
+#ifndef MPACC_GUARD_BITS
+#define MPACC_GUARD_BITS 32
+#endif
+
+/**
+ ** @brief Exact accumulator for MpIeee sums and dot products.
+ **/
+class MpAccumulator {
+
+public:
+  /**
+   ** @name Constructors
+   **
+   ** Products are taken of numbers of at most prec digits, or of the
+   ** precision of MpIeee::fpEnv, in the radix of MpIeee::fpEnv.  The
+   ** accumulator starts at +0.
+   **/
+  /*@{*/
+  MpAccumulator();
+  MpAccumulator( unsigned int prec );
+  MpAccumulator( const MpAccumulator& A );
+  /*@}*/
+
+  ~MpAccumulator();
+
+  void operator= ( const MpAccumulator& A );
+
+  /**
+   ** @name Adding terms
+   **
+   ** Terms of any exponent range can be added; the factors of a
+   ** product must have at most the precision of the accumulator.
+   **/
+  /*@{*/
+  void add( const MpIeee& X );
+  void sub( const MpIeee& X );
+  void addProduct( const MpIeee& X, const MpIeee& Y );
+  void subProduct( const MpIeee& X, const MpIeee& Y );
+  void add( const MpAccumulator& A );   ///< add the exact sum of A
+  void clear();                         ///< back to +0
+  /*@}*/
+
+  /**
+   ** @name Reading the sum
+   **
+   ** The exact sum rounded once into result, which gives the format.
+   ** sqrtTo() rounds the square root of the exact sum once.  The
+   ** rounding mode is that of MpIeee::fpEnv, or the one given, with
+   ** the exceptions added to flags instead of signalled.  The invalid
+   ** operation of a product of infinity and zero is raised here.
+   **/
+  /*@{*/
+  MpIeee& roundTo( MpIeee& result ) const;
+  MpIeee& roundTo( MpIeee& result, FP_Rnd rounding, FP_Excep& flags ) const;
+  MpIeee& sqrtTo( MpIeee& result ) const;
+  MpIeee& sqrtTo( MpIeee& result, FP_Rnd rounding, FP_Excep& flags ) const;
+  /*@}*/
+
+  /**
+   ** @name Exact sums and dot products of arrays
+   **/
+  /*@{*/
+  static MpIeee& sum( const MpIeee *x, unsigned int n, MpIeee& result );
+  static MpIeee& dot( const MpIeee *x, const MpIeee *y, unsigned int n,
+		      MpIeee& result );
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  unsigned int mpPrecision;   // digits of the factors of a product
+  Digit radix;
+  unsigned int guard;         // digits of carry room on top
+  long top;                   // digit j has weight radix^(top-j)
+  unsigned long width;        // digits per register, 0 if none yet
+  Digit *pos;                 // positive terms
+  Digit *neg;                 // negative terms
+  Digit *work;                // 2 prec digits for a product
+  unsigned long first;        // digits first..last may be nonzero,
+  unsigned long last;         // none if first > last
+  unsigned long count;        // nr. of nonzero terms
+  int zeros;                  // 1 a +0 term, 2 a -0 term, 3 both
+  int infs;                   // 1 +inf, 2 -inf, 3 both
+  int nan;                    // 1 a NaN term, 2 an invalid product
+
+  void allocate( unsigned int prec );
+  int fits( const MpIeee& X ) const;
+  int cover( long hi, long lo );
+  void addAt( Digit *r, unsigned long at, const Digit *d, unsigned long n );
+  int deposit( int negate, long e, const Digit *d, unsigned long n );
+  Digit *difference( unsigned long& n, sign& s ) const;
+  MpIeee& zero( MpIeee& result, FP_Rnd rounding ) const;
+  FP_Excep round( MpIeee& result, FP_Rnd rounding ) const;
+  FP_Excep root( MpIeee& result, FP_Rnd rounding ) const;
+  void addTerm( const MpIeee& X, int negate );
+  void addProductTerm( const MpIeee& X, const MpIeee& Y, int negate );
+};
+
+#ifndef OUTLINE
+#include "MpAccumulator.icc"
+#endif
+
+#endif /* _ARITHMOS_MPACCUMULATOR_H_ */
@@ -0,0 +1,191 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpAgm : Logarithm by the AGM and exponential by Newton iteration
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpAgm.hh
+ ** @brief    Logarithm by the AGM and exponential by Newton iteration
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** ln x from the arithmetic-geometric mean, in O(log n) square roots
+ ** and products, and exp x by a Newton iteration on ln, doubling the
+ ** precision at every step.  Both cost O(M(n) log n), with M(n) the
+ ** cost of a product of n digits, against the O(n^(1/3) M(n)) or
+ ** worse of the series; they pay off for precisions of some thousands
+ ** of bits.  Above the threshold, MpSeries takes the exponential of
+ ** exp, sinh, cosh and tanh from here, and MpIeee::naturallog(),
+ ** log2(), log10(), exp2(), exp10() and pow() call the functions
+ ** below.
+ **/
+
+/*
+ * Some notes on the evaluation.
+ *
+ * For s > 2^(n/2), with n the number of bits of the precision,
+ *
+ *	ln s = pi / (2 AGM(1, 4/s)) + O(n / s^2)
+ *
+ * and ln x = ln( x radix^m ) - m ln radix, with m such that s = x
+ * radix^m is just large enough.  pi and ln radix come from
+ * MpConstants.  The subtraction loses the digits of log2 n for x near
+ * 1 and as many more as x - 1 has leading zeros; these are added to
+ * the working precision.  The AGM converges quadratically, after
+ * about log2 n steps.
+ *
+ * exp t, for t = x - k ln radix reduced as in MpSeries, is the root
+ * of ln y - t.  Newton's iteration
+ *
+ *	y' = y + y (t - ln y)
+ *
+ * doubles the number of correct digits, so every step runs at twice
+ * the precision of the previous one, up to the working precision,
+ * from a start below the threshold taken from the series.  The total
+ * is about twice the cost of the last logarithm.
+ *
+ * exp2, exp10 and pow are exp of y ln x, with ln x to the extra digits
+ * that the magnitude of y ln x takes.  Integer powers, which may be
+ * exact, are computed exactly by repeated squaring when they have few
+ * enough digits and rounded once.  log2 and log10 recognize the exact
+ * powers of 2 and 10.
+ *
+ * The results are rounded after Ziv, as in MpSeries, with the same
+ * guard bits and retries.  The other exact cases are x^y for y = c/d
+ * with d a divisor of a power of the radix, such as sqrt x or x^0.75:
+ * if the first attempt fails, its result v rounded to the precision is
+ * tested by v^d = x^c, exactly, and returned if that holds.
+ */
+
+#ifndef _ARITHMOS_MPAGM_H_
+#define _ARITHMOS_MPAGM_H_
+
+#include <MpIeee.hh>
+#include <MpConstants.hh>
+
+#ifndef MPAGM_THRESHOLD
+#define MPAGM_THRESHOLD 10000 ///< bits of precision above which the AGM
+                              ///< and Newton are used
+#endif
+
+#ifndef MPAGM_GUARD
+#define MPAGM_GUARD 32        ///< guard bits beyond the precision
+#endif
+
+/**
+ ** @brief AGM logarithm and Newton exponential.
+ **/
+class MpAgm {
+
+public:
+  /**
+   ** @name Elementary functions
+   **
+   ** f(X), rounded to the format of result in the current rounding
+   ** mode, or in the given one with the exceptions added to flags
+   ** instead of signalled, at any precision.  X and result may be the
+   ** same MpIeee.  pow() follows IEEE 754 for its special cases.
+   **/
+  /*@{*/
+  static MpIeee& ln( const MpIeee& X, MpIeee& result );
+  static MpIeee& log2( const MpIeee& X, MpIeee& result );
+  static MpIeee& log10( const MpIeee& X, MpIeee& result );
+  static MpIeee& exp2( const MpIeee& X, MpIeee& result );
+  static MpIeee& exp10( const MpIeee& X, MpIeee& result );
+  static MpIeee& pow( const MpIeee& X, const MpIeee& Y, MpIeee& result );
+  static MpIeee& ln( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		     FP_Excep& flags );
+  static MpIeee& log2( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		       FP_Excep& flags );
+  static MpIeee& log10( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+			FP_Excep& flags );
+  static MpIeee& exp2( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		       FP_Excep& flags );
+  static MpIeee& exp10( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+			FP_Excep& flags );
+  static MpIeee& pow( const MpIeee& X, const MpIeee& Y, MpIeee& result,
+		      FP_Rnd rounding, FP_Excep& flags );
+  /*@}*/
+
+  /**
+   ** @name Threshold
+   **
+   ** active( prec ) is nonzero if a result of prec digits, in the
+   ** radix of MpIeee::fpEnv, is computed here rather than by the
+   ** series.  The threshold is in bits.
+   **/
+  /*@{*/
+  static int active( unsigned int prec );
+  static unsigned long getThreshold();
+  static void setThreshold( unsigned long bits );
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  static unsigned long& threshold();
+  static unsigned int working( unsigned int prec, unsigned long guard );
+
+  static void lnWork( const MpIeee& X, MpIeee& W );
+  static void lnBase( unsigned long base, MpIeee& W );
+  static void expNewton( const MpIeee& T, MpIeee& W );
+  static void expWork( const MpIeee& X, MpIeee& W );
+
+  static int integer( const MpIeee& X, long& n );
+  static unsigned int significant( const MpIeee& X );
+  static MpIeee *power( const MpIeee& X, unsigned long a, double cap );
+  static int equal( const MpIeee& A, const MpIeee& B, int inverse );
+  static int powInt( const MpIeee& X, long n, MpIeee& result,
+		     FP_Rnd rounding, FP_Excep& flags );
+  static int isPower( const MpIeee& X, unsigned long base, long& n );
+  static int powExact( const MpIeee& X, const MpIeee& Y, const MpIeee& W,
+		       MpIeee& result, FP_Rnd rounding, FP_Excep& flags );
+  static MpIeee& exact( const MpIeee& Z, MpIeee& result, FP_Rnd rounding,
+			FP_Excep& flags );
+  static int lnSpecial( const MpIeee& X, MpIeee& result, FP_Excep& flags );
+  static int powSpecial( const MpIeee& X, const MpIeee& Y, MpIeee& result,
+			 FP_Excep& flags );
+  static int parity( const MpIeee& Y );
+
+  static MpIeee *lnAt( const MpIeee& X, int base, unsigned int prec,
+		       unsigned long guard );
+  static MpIeee& logBase( const MpIeee& X, unsigned long base,
+			  MpIeee& result, FP_Rnd rounding, FP_Excep& flags );
+  static MpIeee *expArg( const MpIeee& X, const MpIeee *Y, unsigned long base,
+			 unsigned int prec, unsigned long guard );
+  static MpIeee& expOf( const char *function, const MpIeee& X,
+			const MpIeee *Y, unsigned long base, MpIeee& result,
+			FP_Rnd rounding, FP_Excep& flags );
+  static MpIeee& expBase( const MpIeee& X, unsigned long base,
+			  MpIeee& result, FP_Rnd rounding, FP_Excep& flags );
+  static MpIeee& powPositive( const MpIeee& X, const MpIeee& Y,
+			      MpIeee& result, FP_Rnd rounding,
+			      FP_Excep& flags );
+
+  friend class MpSeries;
+};
+
+#include <MpSeries.hh>
+
+#ifndef OUTLINE
+#include "MpAgm.icc"
+#endif
+
+#endif /* _ARITHMOS_MPAGM_H_ */
@@ -0,0 +1,181 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpBinarySplit : Constants to millions of digits by binary splitting
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpBinarySplit.hh
+ ** @brief    Constants to millions of digits by binary splitting
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** pi (Chudnovsky), e (the series of 1/k!), ln 2 and ln 10 (Machin
+ ** like atanh formulas), evaluated with exact BigInt arithmetic by
+ ** binary splitting and converted once to a MpIeee.  Meant for very
+ ** high precisions, where the subquadratic GMP products pay off; the
+ ** upper levels of the splitting run on several threads.
+ **
+ ** Like BigInt, this has to be linked with the GNU GMP library.
+ **/
+
+/*
+ * Some notes on the evaluation.
+ *
+ * All series are of the form
+ *
+ *	S = sum_k a(k)/b(k) * prod_{j<=k} p(j)/q(j)
+ *
+ * with small integer a, b, p and q.  For a range of terms [m, n) the
+ * splitting computes P = prod p, Q = prod q, B = prod b and
+ * T = B Q S, from those of the two halves [m, c) and [c, n):
+ *
+ *	P = Pl Pr,  Q = Ql Qr,  B = Bl Br,  T = Br Qr Tl + Bl Pl Tr
+ *
+ * P is not needed for a range that ends with the last term, B is 1
+ * and left out for pi and e, P is 1 and left out for e and atanh.
+ *
+ *	pi      = 426880 sqrt(10005) Q / T, Chudnovsky
+ *	e       = T / Q, a = p = 1, q(k) = k
+ *	atanh 1/x = T / (B Q), a = p = 1, b(k) = 2k+1, q(0) = x,
+ *		q(k) = x^2
+ *	ln 2    = 18 atanh 1/26 - 2 atanh 1/4801 + 8 atanh 1/8749
+ *	ln 10   = 46 atanh 1/31 + 34 atanh 1/49 + 20 atanh 1/161
+ *
+ * The quotients are computed as integers N = floor( S R^m ), radix R,
+ * with MPSPLIT_GUARD bits more than the precision of the result.
+ * The digits of N are produced by splitting N at powers R^(c 2^j),
+ * and rounded once, with a sticky digit since the constants are
+ * irrational.  N is off by a few units, so the result is correctly
+ * rounded unless the guard digits are all at a rounding boundary.
+ */
+
+#ifndef _ARITHMOS_MPBINARYSPLIT_H_
+#define _ARITHMOS_MPBINARYSPLIT_H_
+
+#include <MpIeee.hh>
+#include <BigInt.hh>
+#include <MpParallel.hh>
+#ifndef _WINDOWS_MSVC_
+#include <sys/time.h>
+#endif
+
+/**
+ ** @name	Binary splitting parameters
+ **/
+/*@{*/
+#ifndef MPSPLIT_GUARD
+#define MPSPLIT_GUARD 64       ///< guard bits beyond the precision
+#endif
+#ifndef MPSPLIT_PARALLEL
+#define MPSPLIT_PARALLEL 2048  ///< min. nr. of terms to split over threads
+#endif
+#ifndef MPSPLIT_BASECASE
+#define MPSPLIT_BASECASE 32    ///< digits converted by plain division
+#endif
+/*@}*/
+
+/**
+ ** Progress report: the constant, the phase that has just ended and
+ ** the wall-clock seconds it took.
+ **/
+typedef void (*mp_split_report)( const char *constant, const char *phase,
+				 double seconds );
+
+/**
+ ** @brief Binary splitting evaluation of pi, e, ln 2 and ln 10.
+ **/
+class MpBinarySplit {
+
+public:
+  /**
+   ** @name Constants
+   **
+   ** Rounded to the format of result in the current rounding mode.
+   ** The number of threads is MpParallel::getThreads().
+   **/
+  /*@{*/
+  static MpIeee& pi( MpIeee& result );
+  static MpIeee& e( MpIeee& result );
+  static MpIeee& ln2( MpIeee& result );
+  static MpIeee& ln10( MpIeee& result );
+  /*@}*/
+
+  /**
+   ** @name Progress report
+   **
+   ** Called after every phase; 0, the default, reports nothing.
+   **/
+  /*@{*/
+  static void setReport( mp_split_report report );
+  static void printReport( const char *constant, const char *phase,
+			   double seconds );     ///< to cerr
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  typedef enum MpSplit_Series { MP_SPLIT_PI, MP_SPLIT_E,
+				MP_SPLIT_ATANH } series;
+
+  struct Sum {                 // one series
+    series kind;
+    unsigned long x;          // atanh 1/x
+    unsigned long n;          // nr. of terms
+  };
+
+  struct Node {                // one range of terms
+    BigInt P, Q, B, T;
+  };
+
+  struct Job {                 // a range for another thread
+    const Sum *sum;
+    unsigned long m, n;
+    Node *node;
+    unsigned int threads;
+  };
+
+  static mp_split_report& report();
+  static double wallTime();
+  static void phase( const char *constant, const char *name, double& t );
+
+  static unsigned long bits( unsigned int prec, Digit radix );
+  static unsigned long digits( unsigned long bits, Digit radix );
+  static unsigned long terms( series kind, unsigned long x,
+			      unsigned long bits );
+  static void leaf( const Sum& s, unsigned long k, Node& r );
+  static void split( const Sum& s, unsigned long m, unsigned long n,
+		     Node& r, unsigned int threads );
+  static void splitJob( void *job );
+  static void evaluate( const Sum& s, Node& r );
+
+  static void scale( BigInt& S, unsigned long m, Digit radix );
+  static void atanh( BigInt& N, unsigned long x, const BigInt& S,
+		     unsigned long bits );
+  static void toDigits( mpz_t n, Digit *d, unsigned long len,
+			mpz_t *powers, int level, unsigned long radix );
+  static MpIeee& convert( const char *constant, BigInt& N, unsigned long m,
+			  MpIeee& result, double& t );
+};
+
+#ifndef OUTLINE
+#include "MpBinarySplit.icc"
+#endif
+
+#endif /* _ARITHMOS_MPBINARYSPLIT_H_ */
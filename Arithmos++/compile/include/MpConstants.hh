@@ -0,0 +1,151 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpConstants : Cache of the MpIeee constants
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpConstants.hh
+ ** @brief    Cache of the MpIeee constants
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** pi, pi2, e, ln10 and lnradix, computed once at the highest
+ ** precision asked for so far and rounded to the format of each
+ ** request.  The cache is shared by all threads.  The elementary
+ ** functions take their constants from here; MpIeee::pi() and the
+ ** other generators themselves always compute the constant anew.
+ **
+ ** Above MPCONST_SPLIT bits the constants are generated by
+ ** MpBinarySplit, so, like BigInt, this has to be linked with the GNU
+ ** GMP library.
+ **/
+
+/*
+ * Some notes on the cache.
+ *
+ * A constant is generated in round-towards-zero with at least
+ * MPCONST_GUARD digits more than the request, so the cached digits
+ * are the leading digits of the exact value.  The constants are
+ * irrational, so a copy is rounded with that digit as guard digit and
+ * a nonzero sticky digit, which is correct in every rounding mode.
+ *
+ * A request beyond the cached precision regenerates the constant at
+ * 1.5 times that precision, or more, so a slowly growing precision
+ * does not regenerate it at every step.  The digits depend on the
+ * radix: a constant cached for another radix is regenerated.
+ *
+ * Above MPCONST_SPLIT bits, pi, e and ln 10 come from MpBinarySplit,
+ * ln radix from ln 10 for radix 10 and as j ln 2 for radix 2^j, and
+ * pi2 from pi.  The scaled ones are computed with MPCONST_GUARD more
+ * digits and truncated again.  ln radix of other radices still comes
+ * from lnradix().
+ */
+
+#ifndef _ARITHMOS_MPCONSTANTS_H_
+#define _ARITHMOS_MPCONSTANTS_H_
+
+#include <MpIeee.hh>
+#include <MpThreads.hh>
+#include <MpBinarySplit.hh>
+
+#ifndef MPCONST_GUARD
+#define MPCONST_GUARD 2  ///< extra digits cached beyond a request
+#endif
+#ifndef MPCONST_SPLIT
+#define MPCONST_SPLIT 4096 ///< bits of precision above which the
+                           ///< constants come from MpBinarySplit
+#endif
+
+/**
+ ** Cached constants.
+ **/
+typedef enum    MpConst_Constant {
+  MP_CONST_PI      = 0, ///< pi, as MpIeee::pi()
+  MP_CONST_PI2     = 1, ///< as MpIeee::pi2()
+  MP_CONST_E       = 2, ///< e, as e( prec )
+  MP_CONST_LN10    = 3, ///< ln 10, as ln10( prec )
+  MP_CONST_LNRADIX = 4, ///< ln radix, as lnradix()
+  MP_CONST_COUNT   = 5
+} mp_const_constant;
+
+/**
+ ** @brief Thread-safe cache of the constants.
+ **/
+class MpConstants {
+
+public:
+  /**
+   ** @name Constants
+   **
+   ** The constant, rounded to the format of result in the current
+   ** rounding mode.
+   **/
+  /*@{*/
+  static MpIeee& pi( MpIeee& result );
+  static MpIeee& pi2( MpIeee& result );
+  static MpIeee& e( MpIeee& result );
+  static MpIeee& ln10( MpIeee& result );
+  static MpIeee& lnradix( MpIeee& result );
+  static MpIeee& get( mp_const_constant c, MpIeee& result );
+  /*@}*/
+
+  /**
+   ** @name Cache control
+   **/
+  /*@{*/
+  static void preload( unsigned int prec );  ///< all constants, in the
+                                             ///< radix of MpIeee::fpEnv
+  static void preload( mp_const_constant c, unsigned int prec );
+  static unsigned int cached( mp_const_constant c ); ///< digits, 0 if none
+  static void clear();
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  struct Entry {
+    MpIeee *value;            // 0 if not computed
+    Digit radix;              // radix of the digits
+  };
+
+  struct Cache {
+    MpMutex lock;
+    Entry entry[MP_CONST_COUNT];
+
+    Cache();
+  };
+
+  static Cache& cache();
+  static unsigned int missing( mp_const_constant c, unsigned int prec );
+  static void generate( mp_const_constant c, unsigned int prec,
+			MpIeee& value );
+  static int split( mp_const_constant c, MpIeee& value );
+  static void scale( const MpIeee& x, Digit m, Digit d, MpIeee& value );
+  static int sameLeading( const MpIeee& x, const MpIeee& y,
+			  unsigned int n );
+  static void install( mp_const_constant c, MpIeee *value, Digit radix );
+  static void ensure( mp_const_constant c, unsigned int prec );
+};
+
+#ifndef OUTLINE
+#include "MpConstants.icc"
+#endif
+
+#endif /* _ARITHMOS_MPCONSTANTS_H_ */
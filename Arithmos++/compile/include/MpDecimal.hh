@@ -0,0 +1,269 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpDecimal : Decimal conversion of MpIeee numbers
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpDecimal.hh
+ ** @brief    Decimal conversion of MpIeee numbers
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** Conversion of a MpIeee to any number of decimal digits, and of a
+ ** decimal string of any length to a MpIeee, correctly rounded, in
+ ** time close to that of a multiplication of that many digits.  The
+ ** digits are written straight into the buffer of the caller, there
+ ** is no bound on their number.  toShortest() writes the fewest digits
+ ** that read back as the number, in any format and rounding mode.
+ ** MpIeee::toDecimal(), outputDecimal() and fromDecimal() are meant to
+ ** be built on these functions, and operator<<() on outputShortest()
+ ** in the ARITHMOS_IO_MPIEEE_SHORTEST mode.
+ **/
+
+/*
+ * Some notes on the conversion.
+ *
+ * A finite x is D R^f, D an integer of p digits in radix R.  For n
+ * decimal digits and 10^(k-1) <= |x| < 10^k, the digits are the
+ * integer
+ *
+ *	N = round( D R^f 10^(n-k) )
+ *
+ * the quotient of D R^f' 10^s by R^a 10^b, with f', s, a and b the
+ * positive parts of f, n - k, -f and k - n.  The division by R^a is
+ * a shift; the one by 10^b, if any, is MpDigits::divRem(), with the
+ * Newton division for long operands.  k is estimated in double, and
+ * corrected by one if N turns out to have n - 1 or n + 1 digits.
+ *
+ * N is then written by divide and conquer: N = H 10^h + L, with 10^h
+ * the largest cached power below 10^n, and H and L are written the
+ * same way, down to MPDECIMAL_BASECASE digits, which are peeled off
+ * by divRem1() a chunk of c digits at a time.  10^c is the largest
+ * power of ten that divRem1() can divide by in the radix.
+ *
+ * The powers 10^(c 2^j) are cached per radix, squared from one
+ * another.  Any other power of ten is a product of these and of a
+ * power below 10^c.  All costs are a few multiplications of n digits
+ * per level of the splitting, O( M(n) log n ) in all, instead of the
+ * O( n^2 ) of repeated multiplication by 10^c.
+ *
+ * A decimal string is read the other way around: the m significant
+ * digits are split at 10^h into H and L, read the same way, and the
+ * value is H 10^h + L.  With the decimal exponent e, the significand
+ * of the result, with exponent er, is
+ *
+ *	q = floor( M 10^e R^(p-er) )
+ *
+ * one product or quotient of M and 10^|e|, rounded once like the
+ * digits above.  er is estimated in double and corrected until q has
+ * p digits, or fewer at the smallest exponent.
+ *
+ * The shortest digits are those of the shortest decimal inside the
+ * interval of the numbers that round to x: the halfway points to its
+ * neighbours for round to nearest, the ulp towards or away from zero
+ * for the directed modes.  For formats of at most 53 bits and round to
+ * nearest, x and the bounds are scaled into 64-bit integers by a
+ * cached power of ten and the digits generated as by Grisu3 (Loitsch);
+ * it gives up on the few numbers where the error of the scaling leaves
+ * the answer open.  Those, and all other formats, test a length n
+ * exactly: the two n digit decimals next to x are quotients as above,
+ * and the remainder compared with the bounds tells if one of them is
+ * inside.  Any longer length fits if n does, so n is bisected.
+ */
+
+#ifndef _ARITHMOS_MPDECIMAL_H_
+#define _ARITHMOS_MPDECIMAL_H_
+
+#include <MpIeee.hh>
+#include <MpThreads.hh>
+#include <ArithmosIO.hh>
+#include <string.h>
+#include <ctype.h>
+
+/**
+ ** @name	Decimal conversion parameters
+ **/
+/*@{*/
+#ifndef MPDECIMAL_BASECASE
+#define MPDECIMAL_BASECASE 64  ///< decimal digits written by plain division
+#endif
+#define MPDECIMAL_POWERS 32    ///< max. nr. of cached powers per radix
+#define MPDECIMAL_TENS 400     ///< 10^-400 .. 10^400 cached for shortest()
+#define MPDECIMAL_FAST_DIGITS 32  ///< max. digits of the fast shortest()
+/*@}*/
+
+/**
+ ** @brief Decimal conversion of MpIeee numbers.
+ **/
+class MpDecimal {
+
+public:
+  /**
+   ** @name Conversion to decimal
+   **
+   ** digits() writes the n digits of |x|, a finite nonzero number,
+   ** rounded in the given mode as if x were the number itself, to
+   ** buffer, without a terminating null character, and returns k with
+   ** |x| ~ 0.d1 d2 ... dn 10^k.  toDecimal() writes x as
+   ** -d1.d2...dne-12, or 0, inf or nan, with a terminating null
+   ** character, and needs length( n ) characters; n = 0 takes
+   ** precision( x.prec() ) digits, enough to tell all numbers of the
+   ** format apart, rounded in the rounding mode of MpIeee::fpEnv.
+   **/
+  /*@{*/
+  static long digits( const MpIeee& x, char *buffer, unsigned long n,
+		      FP_Rnd rounding );
+  static char *toDecimal( const MpIeee& x, char *buffer,
+			  unsigned long n = 0 );
+  static void output( ostream& o, const MpIeee& x, unsigned long n = 0 );
+  static unsigned long precision( unsigned int prec );
+  static unsigned long length( unsigned long n );
+  /*@}*/
+
+  /**
+   ** @name Shortest conversion to decimal
+   **
+   ** shortest() writes the fewest digits of |x|, finite and nonzero,
+   ** that fromDecimal() reads back as x in the given rounding mode, the
+   ** ones closest to x if there is a choice, and returns their number
+   ** n; k is as for digits(), and buffer needs precision( x.prec() )
+   ** characters.  toShortest() writes x with these digits as
+   ** toDecimal() does, in the rounding mode of MpIeee::fpEnv, and needs
+   ** length( precision( x.prec() ) ) characters.
+   **/
+  /*@{*/
+  static unsigned long shortest( const MpIeee& x, char *buffer, long& k,
+				 FP_Rnd rounding );
+  static char *toShortest( const MpIeee& x, char *buffer );
+  /*@}*/
+
+  /**
+   ** @name Conversion from decimal
+   **
+   ** fromDecimal() reads [+|-]ddd[.ddd][e[+|-]ddd], inf, infinity or
+   ** nan, in any case and with white space around it, of any length.
+   ** The value is rounded once to the format of result in the rounding
+   ** mode of MpIeee::fpEnv, where the exceptions are signaled; a
+   ** malformed string gives a NaN and an invalid operation.
+   **/
+  /*@{*/
+  static MpIeee& fromDecimal( const char *decimal, MpIeee& result );
+  /*@}*/
+
+  /**
+   ** @name Cache control
+   **/
+  /*@{*/
+  static void clear();     ///< free the cached powers of ten
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  struct Table {               // powers of ten in one radix
+    Digit radix;
+    unsigned int chunk;       // c, digits per divRem1()
+    Digit ten;                // 10^c
+    unsigned int count;       // powers cached
+    Digit *power[MPDECIMAL_POWERS];   // 10^(c 2^j), no leading zeros
+    unsigned int size[MPDECIMAL_POWERS];
+    Table *next;
+  };
+
+  struct DiyFp {                // f 2^e
+    ulonglong f;
+    int e;
+  };
+
+  struct Bound {                // c R^f / 2R, c = 2^two R^shift
+    int two;                  // -1 if there is none
+    unsigned int shift;
+    int in;                   // nonzero if the bound reads back as x
+  };
+
+  struct Interval {             // the numbers that read back as D R^f
+    Digit radix;
+    const Digit *d;           // D, no leading zeros
+    unsigned int nd;
+    long f;
+    long k;                   // 10^(k-1) <= D R^f < 10^k
+    Bound low, high;
+  };
+
+  struct Cache {
+    MpMutex lock;
+    Table *tables;
+    DiyFp tens[2 * MPDECIMAL_TENS + 1];   // 10^t, f = 0 if not yet
+
+    Cache();
+  };
+
+  static Cache& cache();
+  static Table& table( Digit radix );
+  static const Digit *power( unsigned int j, Digit radix,
+			     unsigned int& n );
+  static Digit *pow10( unsigned long s, Digit radix, unsigned int& n );
+  static Digit *fromULong( unsigned long v, Digit radix, unsigned int& n );
+  static const Digit *trim( const Digit *x, unsigned int& n );
+  static void pack( Digit *z, unsigned int& n );
+  static Digit *multiply( const Digit *x, unsigned int nx, const Digit *y,
+			  unsigned int ny, Digit radix, unsigned int& n );
+
+  static Digit *scale( const Digit *x, unsigned int nx, unsigned long s,
+		       unsigned int f, Digit radix, unsigned int& n );
+  static int odd( const Digit *q, unsigned int nq, Digit radix );
+  static int divide( const Digit *num, unsigned int nn, unsigned int a,
+		     unsigned long b, Digit radix, Digit *&q,
+		     unsigned int& nq );
+  static void write( const Table& t, const Digit *x, unsigned int nx,
+		     char *buffer, unsigned long n );
+  static int special( const MpIeee& x, char *buffer );
+  static void format( char *s, unsigned long n, long k );
+
+  static DiyFp product( const DiyFp& x, const DiyFp& y );
+  static ulonglong leading( const Digit *x, unsigned int n, int sticky,
+			    int& e );
+  static DiyFp cached( int t );
+  static int weed( char *buffer, unsigned long n, ulonglong distance,
+		   ulonglong unsafe, ulonglong rest, ulonglong tenKappa,
+		   ulonglong unit );
+  static int generate( const DiyFp& lo, const DiyFp& w, const DiyFp& hi,
+		       char *buffer, unsigned long& n, int& kappa );
+  static int fast( const MpIeee& x, char *buffer, unsigned long& n,
+		   long& k );
+  static Digit *times( const Digit *x, unsigned int nx, int two,
+		       unsigned int shift, Digit radix, unsigned int& n );
+  static int fits( const Interval& v, unsigned long n, Digit *&q,
+		   unsigned int& nq );
+
+  static Digit *read( const Table& t, const char *s, unsigned long m,
+		      unsigned int& n );
+  static int word( const char *&s, const char *w );
+  static FP_Excep assign( const Digit *x, unsigned int nx, long e, sign s,
+			  FP_Rnd rounding, MpIeee& result );
+};
+
+void outputShortest( ostream& o, const MpIeee& s );
+
+#ifndef OUTLINE
+#include "MpDecimal.icc"
+#endif
+
+#endif /* _ARITHMOS_MPDECIMAL_H_ */
@@ -0,0 +1,241 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpDigits : Digit array kernels for the MpIeee class
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpDigits.hh
+ ** @brief    Digit array kernels for the MpIeee class
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** These functions do the digit-level work of MpIeee::add, sub,
+ ** shortProduct, mulByShort, div and round.  They operate on plain
+ ** digit arrays, so they are independent of the representation of
+ ** the exponent and the special values.
+ **/
+
+/*
+ * Some notes on the digit arrays.
+ *
+ * All arrays are stored most significant digit first, just like the
+ * MpIeee significand (pass &X[1] to operate on the significand of X).
+ * Every digit is in the range [0, radix).  The kernels are written
+ * once in terms of Digit and DoubleDigit; with the default double
+ * Digit a DoubleDigit is a double holding an exact product of two
+ * radix 2^24 digits, with the integer limb backend (see FPEnv.hh) it
+ * is a 64-bit unsigned integer.
+ */
+
+#ifndef _ARITHMOS_MPDIGITS_H_
+#define _ARITHMOS_MPDIGITS_H_
+
+#include <FPEnv.hh>
+
+/**
+ ** @name	Default multiplication thresholds
+ **
+ ** Operand sizes, in digits, from which on the faster algorithms are
+ ** used.  They can be changed at run time with
+ ** MpDigits::setThreshold().  The defaults were measured for both
+ ** Digit backends on x86-64; Toom-3 only pays off for long operands
+ ** because of its larger linear overhead.
+ **/
+/*@{*/
+#ifndef MPDIGITS_KARATSUBA_THRESHOLD
+#define MPDIGITS_KARATSUBA_THRESHOLD 24
+#endif
+#ifndef MPDIGITS_TOOM3_THRESHOLD
+#define MPDIGITS_TOOM3_THRESHOLD 400
+#endif
+#ifndef MPDIGITS_MULDERS_THRESHOLD
+#define MPDIGITS_MULDERS_THRESHOLD 48
+#endif
+#ifndef MPDIGITS_FFT_THRESHOLD
+#define MPDIGITS_FFT_THRESHOLD 768
+#endif
+#ifndef MPDIGITS_NEWTON_THRESHOLD
+#define MPDIGITS_NEWTON_THRESHOLD 256
+#endif
+#ifndef MPDIGITS_SQRT_NEWTON_THRESHOLD
+#define MPDIGITS_SQRT_NEWTON_THRESHOLD 40
+#endif
+#ifndef MPDIGITS_SIMD_THRESHOLD
+#define MPDIGITS_SIMD_THRESHOLD 32
+#endif
+/*@}*/
+
+/**
+ ** @brief   max. nr. of digits of a product computed with the FFT
+ ** @remark  Limited by the largest power of two that divides p - 1
+ **          for all three transform primes.
+ **/
+#define MPDIGITS_FFT_MAX_LENGTH 16777216
+
+/**
+ ** Type for the modular arithmetic of the number-theoretic transform.
+ ** It must hold the product of two residues below 2^31.
+ **/
+#ifndef _WINDOWS_MSVC_
+typedef unsigned long long MpNttWord;
+#else
+typedef unsigned __int64 MpNttWord;
+#endif
+
+/**
+ ** Algorithms with a tunable threshold.
+ **/
+typedef enum    MpMul_Alg {
+  MP_MUL_KARATSUBA = 0, ///< Karatsuba full product
+  MP_MUL_TOOM3     = 1, ///< Toom-3 full product
+  MP_MUL_MULDERS   = 2, ///< Mulders short product
+  MP_MUL_FFT       = 3, ///< number-theoretic transform product
+  MP_NEWTON        = 4, ///< Newton division
+  MP_SQRT_NEWTON   = 5, ///< Newton square root
+  MP_SIMD          = 6  ///< vectorized linear kernels (see MpDigitsSimd.hh)
+} mp_mul_alg;
+
+/**
+ ** @brief Digit array kernels.
+ **
+ ** Class without data, grouping the digit array kernels of the
+ ** MpIeee class.  The linear kernels return the carry (or borrow, or
+ ** remainder) out of the most significant digit.
+ **/
+class MpDigits {
+
+public:
+  /**
+   ** @name Single digit operations
+   **/
+  /*@{*/
+  static void split( DoubleDigit t, Digit radix, Digit& hi, Digit& lo );
+  /*@}*/
+
+  /**
+   ** @name Linear kernels
+   **/
+  /*@{*/
+  static Digit add( Digit *z, const Digit *x, const Digit *y,
+		    unsigned int n, Digit radix );
+  static Digit sub( Digit *z, const Digit *x, const Digit *y,
+		    unsigned int n, Digit radix );
+  static Digit mul1( Digit *z, const Digit *x, unsigned int n, Digit d,
+		     Digit radix );
+  static Digit addMul1( Digit *z, const Digit *x, unsigned int n, Digit d,
+			Digit radix );
+  static Digit divRem1( Digit *z, const Digit *x, unsigned int n, Digit d,
+			Digit radix );
+  static Digit mulBy2( Digit *z, const Digit *x, unsigned int n,
+		       Digit radix );
+  static Digit divBy2( Digit *z, const Digit *x, unsigned int n,
+		       Digit radix );
+  static Digit addInto( Digit *z, unsigned int nz, const Digit *x,
+			unsigned int nx, Digit radix );
+  static Digit subInto( Digit *z, unsigned int nz, const Digit *x,
+			unsigned int nx, Digit radix );
+  static int cmp( const Digit *x, const Digit *y, unsigned int n );
+  static int cmp( const Digit *x, unsigned int nx, const Digit *y,
+		  unsigned int ny );
+  static void zero( Digit *z, unsigned int n );
+  static void copy( Digit *z, const Digit *x, unsigned int n );
+  /*@}*/
+
+  /**
+   ** @name Products
+   **/
+  /*@{*/
+  static void mul( Digit *z, const Digit *x, unsigned int nx,
+		   const Digit *y, unsigned int ny, Digit radix );
+  static void mulHigh( Digit *z, const Digit *x, const Digit *y,
+		       unsigned int n, Digit radix );
+
+  static void mulBasecase( Digit *z, const Digit *x, unsigned int nx,
+			   const Digit *y, unsigned int ny, Digit radix );
+  static void mulKaratsuba( Digit *z, const Digit *x, const Digit *y,
+			    unsigned int n, Digit radix );
+  static void mulToom3( Digit *z, const Digit *x, const Digit *y,
+			unsigned int n, Digit radix );
+  static void mulFFT( Digit *z, const Digit *x, unsigned int nx,
+		      const Digit *y, unsigned int ny, Digit radix );
+  static void mulHighBasecase( Digit *z, const Digit *x, const Digit *y,
+			       unsigned int n, Digit radix );
+  /*@}*/
+
+  /**
+   ** @name Division and square root
+   **/
+  /*@{*/
+  static void divRem( Digit *q, Digit *r, const Digit *a, unsigned int na,
+		      const Digit *b, unsigned int nb, Digit radix );
+  static void recip( Digit *y, const Digit *b, unsigned int n,
+		     Digit radix, int exact = 1 );
+  static void sqrtRem( Digit *s, Digit *r, const Digit *a, unsigned int n,
+		       Digit radix );
+  static void invSqrt( Digit *z, const Digit *a, unsigned int n,
+		       Digit radix, int exact = 1 );
+
+  static void divRemBasecase( Digit *q, Digit *r, const Digit *a,
+			      unsigned int na, const Digit *b,
+			      unsigned int nb, Digit radix,
+			      Digit *work = 0 );
+  static void sqrtRemBasecase( Digit *s, Digit *r, const Digit *a,
+			       unsigned int n, Digit radix );
+  /*@}*/
+
+  /**
+   ** @name Tuning
+   **/
+  /*@{*/
+  static unsigned int getThreshold( mp_mul_alg alg );
+  static void setThreshold( mp_mul_alg alg, unsigned int n );
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  static unsigned int *thresholds();
+  static void mulN( Digit *z, const Digit *x, const Digit *y,
+		    unsigned int n, Digit radix );
+
+  static unsigned int nttMulMod( unsigned int a, unsigned int b,
+				 unsigned int p );
+  static unsigned int nttPowMod( unsigned int a, unsigned int e,
+				 unsigned int p );
+  static void ntt( unsigned int *a, unsigned int n, unsigned int p,
+		   unsigned int g, int inverse );
+  static void nttAdd( MpNttWord *w, MpNttWord v, unsigned int at );
+
+  static void div21( DoubleDigit t, Digit d, DoubleDigit& q,
+		     DoubleDigit& r );
+  static unsigned int newtonStack( unsigned int n, unsigned int base,
+				   Digit radix, unsigned int *stack );
+  static void divRemNewton( Digit *q, Digit *r, const Digit *a,
+			    unsigned int na, const Digit *b,
+			    unsigned int nb, Digit radix );
+};
+
+#include <MpDigitsSimd.hh>
+
+#ifndef OUTLINE
+#include "MpDigits.icc"
+#endif
+
+#endif /* _ARITHMOS_MPDIGITS_H_ */
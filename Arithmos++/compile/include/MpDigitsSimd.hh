@@ -0,0 +1,266 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpDigitsSimd : Vectorized digit array kernels
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpDigitsSimd.hh
+ ** @brief    Vectorized digit array kernels
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** SSE2, AVX2 and AVX-512 versions of the linear MpDigits kernels for
+ ** double digits.  The instruction set is chosen at run time from the
+ ** features of the CPU; MpDigits calls these kernels for arrays of at
+ ** least MP_SIMD digits.  MpDigitsSimd::setIsa( MP_ISA_SCALAR ) falls
+ ** back to the scalar reference kernels, e.g. to verify the results.
+ **
+ ** This file is included by MpDigits.hh, do not include it directly.
+ **/
+
+/*
+ * Some notes on the vector kernels.
+ *
+ * The digits are processed in blocks of at most 64.  First every lane
+ * computes its digit sum (or difference, or the two halves of its
+ * digit product) without any carry.  Each such sum is below 2 radix,
+ * so the carry into a digit is generated if the digit below has a
+ * sum >= radix, and propagated if that sum is radix - 1.  With one
+ * bit per digit in G and P, least significant digit in bit 0, the
+ * carries into all digits of the block are
+ *
+ *	C = (((G << 1) | cin) + P) ^ P
+ *
+ * and a second, again independent, pass over the lanes adds them.
+ * Borrows work the same way, with "negative" and "zero".
+ *
+ * The lane masks are collected in memory order, most significant
+ * digit in bit 0, and bit reversed for the addition above.
+ */
+
+#ifndef _ARITHMOS_MPDIGITSSIMD_H_
+#define _ARITHMOS_MPDIGITSSIMD_H_
+
+#include <FPEnv.hh>
+
+/*
+ * The vector kernels need GCC style target attributes and intrinsics,
+ * and only exist for double digits.  Define MPDIGITS_NO_SIMD to leave
+ * them out.
+ */
+#if !defined(MPDIGITS_NO_SIMD) && !defined(INTTYPE) && \
+    defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MPDIGITS_SIMD
+#include <immintrin.h>
+#endif
+
+/**
+ ** Instruction sets for the digit kernels.
+ **/
+typedef enum    MpSimd_Isa {
+  MP_ISA_SCALAR = 0, ///< scalar reference kernels
+  MP_ISA_SSE2   = 1, ///< 2 digits per vector
+  MP_ISA_AVX2   = 2, ///< 4 digits per vector
+  MP_ISA_AVX512 = 3  ///< 8 digits per vector
+} mp_simd_isa;
+
+#ifdef MPDIGITS_SIMD
+
+/**
+ ** One bit per digit of a block.
+ **/
+typedef unsigned long long MpLaneMask;
+
+#define MPSIMD_SSE2   __attribute__(( target( "sse2" ) ))
+#define MPSIMD_AVX2   __attribute__(( target( "avx2" ) ))
+#define MPSIMD_AVX512 __attribute__(( target( "avx512f" ) ))
+
+/*
+ * The block operations of one instruction set.  m is a multiple of
+ * width and at most 64; bit k of a mask belongs to digit k.
+ *
+ *  sum	     z = x + y, g: z >= radix, p: z == radix - 1
+ *  diff     z = x - y, g: z < 0, p: z == 0
+ *  carry    add the carries c, reduce modulo radix
+ *  borrow   subtract the borrows b, reduce modulo radix
+ *  mulSplit x * d (+ z if z is nonzero) = hi * radix + lo
+ *  shiftSum z = z + hi[1..m], masks as for sum
+ *  mulBy2   z = 2 x mod radix + carries from x[1..m]
+ *  divBy2   z = floor(x / 2) + radix/2 for odd x[-1..m-2], from the top
+ */
+
+/**
+ ** @brief SSE2 block operations.
+ **/
+class MpSimdSse2 {
+public:
+  enum { width = 2 };
+
+  MPSIMD_SSE2 static void sum( Digit *z, const Digit *x, const Digit *y,
+			       unsigned int m, Digit radix,
+			       MpLaneMask& g, MpLaneMask& p );
+  MPSIMD_SSE2 static void diff( Digit *z, const Digit *x, const Digit *y,
+				unsigned int m, MpLaneMask& g, MpLaneMask& p );
+  MPSIMD_SSE2 static void carry( Digit *z, unsigned int m, MpLaneMask c,
+				 Digit radix );
+  MPSIMD_SSE2 static void borrow( Digit *z, unsigned int m, MpLaneMask b,
+				  Digit radix );
+  MPSIMD_SSE2 static void mulSplit( Digit *lo, Digit *hi, const Digit *x,
+				    const Digit *z, unsigned int m, Digit d,
+				    Digit radix );
+  MPSIMD_SSE2 static void shiftSum( Digit *z, const Digit *hi,
+				    unsigned int m, Digit radix,
+				    MpLaneMask& g, MpLaneMask& p );
+  MPSIMD_SSE2 static void mulBy2( Digit *z, const Digit *x, unsigned int m,
+				  Digit radix );
+  MPSIMD_SSE2 static void divBy2( Digit *z, const Digit *x, unsigned int m,
+				  Digit radix );
+};
+
+/**
+ ** @brief AVX2 block operations.
+ **/
+class MpSimdAvx2 {
+public:
+  enum { width = 4 };
+
+  MPSIMD_AVX2 static void sum( Digit *z, const Digit *x, const Digit *y,
+			       unsigned int m, Digit radix,
+			       MpLaneMask& g, MpLaneMask& p );
+  MPSIMD_AVX2 static void diff( Digit *z, const Digit *x, const Digit *y,
+				unsigned int m, MpLaneMask& g, MpLaneMask& p );
+  MPSIMD_AVX2 static void carry( Digit *z, unsigned int m, MpLaneMask c,
+				 Digit radix );
+  MPSIMD_AVX2 static void borrow( Digit *z, unsigned int m, MpLaneMask b,
+				  Digit radix );
+  MPSIMD_AVX2 static void mulSplit( Digit *lo, Digit *hi, const Digit *x,
+				    const Digit *z, unsigned int m, Digit d,
+				    Digit radix );
+  MPSIMD_AVX2 static void shiftSum( Digit *z, const Digit *hi,
+				    unsigned int m, Digit radix,
+				    MpLaneMask& g, MpLaneMask& p );
+  MPSIMD_AVX2 static void mulBy2( Digit *z, const Digit *x, unsigned int m,
+				  Digit radix );
+  MPSIMD_AVX2 static void divBy2( Digit *z, const Digit *x, unsigned int m,
+				  Digit radix );
+};
+
+/**
+ ** @brief AVX-512 block operations.
+ **/
+class MpSimdAvx512 {
+public:
+  enum { width = 8 };
+
+  MPSIMD_AVX512 static void sum( Digit *z, const Digit *x, const Digit *y,
+				 unsigned int m, Digit radix,
+				 MpLaneMask& g, MpLaneMask& p );
+  MPSIMD_AVX512 static void diff( Digit *z, const Digit *x, const Digit *y,
+				  unsigned int m, MpLaneMask& g,
+				  MpLaneMask& p );
+  MPSIMD_AVX512 static void carry( Digit *z, unsigned int m, MpLaneMask c,
+				   Digit radix );
+  MPSIMD_AVX512 static void borrow( Digit *z, unsigned int m, MpLaneMask b,
+				    Digit radix );
+  MPSIMD_AVX512 static void mulSplit( Digit *lo, Digit *hi, const Digit *x,
+				      const Digit *z, unsigned int m, Digit d,
+				      Digit radix );
+  MPSIMD_AVX512 static void shiftSum( Digit *z, const Digit *hi,
+				      unsigned int m, Digit radix,
+				      MpLaneMask& g, MpLaneMask& p );
+  MPSIMD_AVX512 static void mulBy2( Digit *z, const Digit *x,
+				    unsigned int m, Digit radix );
+  MPSIMD_AVX512 static void divBy2( Digit *z, const Digit *x,
+				    unsigned int m, Digit radix );
+};
+
+#endif /* MPDIGITS_SIMD */
+
+/**
+ ** @brief Vectorized digit array kernels.
+ **
+ ** Same interface as the corresponding MpDigits kernels.  mulBy2 and
+ ** divBy2 need an even radix, as all MpIeee radices are.
+ **/
+class MpDigitsSimd {
+
+public:
+  /**
+   ** @name Instruction set
+   **/
+  /*@{*/
+  static mp_simd_isa bestIsa();
+  static mp_simd_isa getIsa();
+  static mp_simd_isa setIsa( mp_simd_isa isa );
+  /*@}*/
+
+#ifdef MPDIGITS_SIMD
+  /**
+   ** @name Kernels
+   **/
+  /*@{*/
+  static Digit add( Digit *z, const Digit *x, const Digit *y,
+		    unsigned int n, Digit radix );
+  static Digit sub( Digit *z, const Digit *x, const Digit *y,
+		    unsigned int n, Digit radix );
+  static Digit mul1( Digit *z, const Digit *x, unsigned int n, Digit d,
+		     Digit radix );
+  static Digit addMul1( Digit *z, const Digit *x, unsigned int n, Digit d,
+			Digit radix );
+  static Digit mulBy2( Digit *z, const Digit *x, unsigned int n,
+		       Digit radix );
+  static Digit divBy2( Digit *z, const Digit *x, unsigned int n,
+		       Digit radix );
+  /*@}*/
+#endif
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  static mp_simd_isa& current();
+
+#ifdef MPDIGITS_SIMD
+  static MpLaneMask reverse( MpLaneMask a, unsigned int m );
+  static MpLaneMask propagate( MpLaneMask g, MpLaneMask p, unsigned int m,
+			       Digit& c );
+
+  template <class V>
+  static Digit addWith( Digit *z, const Digit *x, const Digit *y,
+			unsigned int n, Digit radix );
+  template <class V>
+  static Digit subWith( Digit *z, const Digit *x, const Digit *y,
+			unsigned int n, Digit radix );
+  template <class V>
+  static Digit addMul1With( Digit *z, const Digit *x, unsigned int n,
+			    Digit d, Digit radix, int accumulate );
+  template <class V>
+  static Digit mulBy2With( Digit *z, const Digit *x, unsigned int n,
+			   Digit radix );
+  template <class V>
+  static Digit divBy2With( Digit *z, const Digit *x, unsigned int n,
+			   Digit radix );
+#endif
+};
+
+#ifndef OUTLINE
+#include "MpDigitsSimd.icc"
+#endif
+
+#endif /* _ARITHMOS_MPDIGITSSIMD_H_ */
@@ -0,0 +1,192 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpDouble : Hardware double arithmetic for formats of at most 53 bits
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpDouble.hh
+ ** @brief    Hardware double arithmetic for formats of at most 53 bits
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** Addition, subtraction, multiplication, division and square root of
+ ** finite, nonzero numbers whose significands fit in a double, i.e.
+ ** radix 2^b and b * prec <= 53: IEEE single and double, and anything
+ ** in between.  The operation is done by the hardware and rounded once
+ ** to the target format, in any rounding mode, with its exponent range,
+ ** denormals and the exception flags of the software path.
+ ** MpIeeeVector and MpIeeeN use the kernels for every element of such
+ ** a format, as do the MpIeee overloads with an explicit rounding
+ ** mode; MpIeee::add, sub, mul, div and sqroot try the MpIeee functions
+ ** below first.  Wider formats go to the double-double and quad-double
+ ** kernels of MpMultiDouble.  MpDouble::setEnabled( 0 ) switches back
+ ** to the digit kernels, e.g. to verify the results.
+ **
+ ** This file is included by MpIeee.hh, do not include it directly.
+ **/
+
+/*
+ * Some notes on the rounding.
+ *
+ * The significands are taken as integers x, y < 2^53, with the
+ * exponents kept apart, so the hardware never overflows or
+ * underflows.  The hardware result s, rounded to nearest, comes with
+ * its exact error: for the sum and the product from the error free
+ * transformations
+ *
+ *	a + b = s + t	(Knuth's TwoSum)
+ *	a * b = p + t	(fma, or Dekker's TwoProduct)
+ *
+ * for the quotient and the root from the exact remainders x - q y and
+ * x - s^2.  Only the sign of the error is needed: |t| is below half
+ * an ulp of s, so the digits of s below the target precision tell on
+ * which side of the rounding boundary the exact value lies, and the
+ * sign of t decides if they are exactly at it (a tie, or an exact
+ * result).  This is one rounding of the exact value, never the double
+ * rounding of s.
+ *
+ * Formats below 53 bits in a larger radix have a wobbling precision;
+ * the rounding position follows the leading digit of s, and for
+ * results just below a power of the radix, that of the next lower
+ * binade.
+ *
+ * The error free transformations need a double without extended
+ * precision; on x87 floating point (FLT_EVAL_METHOD != 0) the kernels
+ * are left out.  Define MPDOUBLE_NO_HARDWARE to leave them out
+ * anyway.
+ */
+
+#ifndef _ARITHMOS_MPDOUBLE_H_
+#define _ARITHMOS_MPDOUBLE_H_
+
+#if !defined(MPDOUBLE_NO_HARDWARE) && \
+    !(defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ != 0)
+#define MPDOUBLE_HARDWARE
+#endif
+
+/**
+ ** @brief Hardware double arithmetic for short binary formats.
+ **/
+class MpDouble {
+
+public:
+  /**
+   ** Exact result of an operation: s 2^e with s >= 0 and sign sgn.
+   ** The exact value is above s (tail 1), equal to it (tail 0) or
+   ** below it (tail -1) in absolute value, by less than half an ulp
+   ** of s.  s = 0 for a sum that cancels exactly.
+   **/
+  struct Exact {
+    double s;
+    long e;
+    int tail;
+    sign sgn;
+  };
+
+  /**
+   ** @name Formats
+   **
+   ** radixBits() is b if the radix of MpIeee::fpEnv is 2^b and the
+   ** kernels are available, 0 otherwise.  bits( prec ) is b if also b
+   ** prec <= 53 and the kernels are enabled; 0 otherwise.
+   **/
+  /*@{*/
+  static unsigned int radixBits();
+  static unsigned int bits( unsigned int prec );
+  static int getEnabled();
+  static void setEnabled( int enabled );
+  /*@}*/
+
+  /**
+   ** @name MpIeee operations
+   **
+   ** result = op1 op op2, rounded to the format of result.  They
+   ** return 0 and leave result alone if the format is too wide, the
+   ** precisions differ, or an operand is zero, infinite, NaN, or
+   ** negative for sqrt;
+   ** the software path handles those.  Without a rounding mode, that
+   ** of MpIeee::fpEnv is used and the exceptions are signaled there.
+   **/
+  /*@{*/
+  static int add( const MpIeee& op1, const MpIeee& op2, MpIeee& result );
+  static int sub( const MpIeee& op1, const MpIeee& op2, MpIeee& result );
+  static int mul( const MpIeee& op1, const MpIeee& op2, MpIeee& result );
+  static int div( const MpIeee& op1, const MpIeee& op2, MpIeee& result );
+  static int sqrt( const MpIeee& op, MpIeee& result );
+
+  static int add( const MpIeee& op1, const MpIeee& op2, MpIeee& result,
+		  FP_Rnd rounding, FP_Excep& flags );
+  static int sub( const MpIeee& op1, const MpIeee& op2, MpIeee& result,
+		  FP_Rnd rounding, FP_Excep& flags );
+  static int mul( const MpIeee& op1, const MpIeee& op2, MpIeee& result,
+		  FP_Rnd rounding, FP_Excep& flags );
+  static int div( const MpIeee& op1, const MpIeee& op2, MpIeee& result,
+		  FP_Rnd rounding, FP_Excep& flags );
+  static int sqrt( const MpIeee& op, MpIeee& result, FP_Rnd rounding,
+		   FP_Excep& flags );
+  /*@}*/
+
+  /**
+   ** @name Kernels
+   **
+   ** unpack() reads the prec digits d[0], d[stride], ... of a finite
+   ** number with the given exponent as x 2^e, x an integer.  The
+   ** operations take such operands, nonzero, and round() stores the
+   ** result in the same form through MpRound::round(): zero at
+   ** exponent l - 1 and, on an overflow, the largest number.  round()
+   ** returns the exceptions raised.
+   **/
+  /*@{*/
+  static double unpack( const Digit *d, unsigned int stride,
+			unsigned int prec, int exponent, unsigned int b,
+			long& e );
+  static void sum( double x, sign sx, long ex, double y, sign sy, long ey,
+		   Exact& r );
+  static void product( double x, long ex, double y, long ey, sign s,
+		       Exact& r );
+  static void quotient( double x, long ex, double y, long ey, sign s,
+			Exact& r );
+  static void root( double x, long ex, Exact& r );
+  static FP_Excep round( const Exact& r, unsigned int b, unsigned int prec,
+			 int l, int u, FP_Rnd rounding, Digit *d,
+			 unsigned int stride, int& exponent, sign& s );
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  static int& enabled();
+  static void twoSum( double a, double b, double& s, double& t );
+  static void twoProduct( double a, double b, double& p, double& t );
+  static int finite( const MpIeee& X, const MpIeee& result );
+  static int binary( char op, const MpIeee& op1, const MpIeee& op2,
+		     MpIeee& result, FP_Rnd rounding, FP_Excep& flags );
+  static int signal( int done, FP_Excep flags );
+
+  friend class MpMultiDouble;
+};
+
+#include "MpMultiDouble.hh"
+
+#ifndef OUTLINE
+#include "MpDouble.icc"
+#endif
+
+#endif /* _ARITHMOS_MPDOUBLE_H_ */
@@ -0,0 +1,111 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpFused : Fused, single rounding MpIeee sums of products
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpFused.hh
+ ** @brief    Fused, single rounding MpIeee sums of products
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** A MpFusedSum collects products and addends, adds them exactly in a
+ ** digit buffer wide enough for all of them, and rounds the sum once.
+ ** It is the kernel behind MpIeee::fma, MpIeee::fms, MpIeee::dot and
+ ** the expression templates in MpIeeeExpr.hh.
+ **/
+
+/*
+ * MpIeee.hh includes this file itself, so it has to come before the
+ * guard.
+ */
+#include <MpIeee.hh>
+
+#ifndef _ARITHMOS_MPFUSED_H_
+#define _ARITHMOS_MPFUSED_H_
+
+#include <MpAccumulator.hh>
+
+/**
+ ** @brief   max. nr. of digits of the exact sum, in units of the precision
+ ** @remark  Sums whose terms are spread over more digits than this are
+ **          added in a MpAccumulator instead, still rounded once.
+ **/
+#ifndef MPFUSED_MAX_SPREAD
+#define MPFUSED_MAX_SPREAD 64
+#endif
+
+/**
+ ** @brief Exact sum of MpIeee products with one final rounding.
+ **
+ ** The terms are only referenced, so the MpIeees they refer to have
+ ** to live until roundTo() is called.
+ **/
+class MpFusedSum {
+
+public:
+  MpFusedSum();
+  ~MpFusedSum();
+
+  /**
+   ** @name Collecting terms
+   **/
+  /*@{*/
+  void addProduct( const MpIeee& X, const MpIeee& Y, int negate = 0 );
+  void addTerm( const MpIeee& X, int negate = 0 );
+  unsigned int terms() const;
+  /*@}*/
+
+  /// Round the exact sum of all terms once into result.
+  MpIeee& roundTo( MpIeee& result ) const;
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  struct Term {
+    const MpIeee *x;  // factor or addend
+    const MpIeee *y;  // second factor, 0 for an addend
+    int negate;       // subtract the term
+  };
+
+  enum { inlineTerms = 8 };
+
+  Term mInline[inlineTerms];
+  Term *mTerms;
+  unsigned int mCount;
+  unsigned int mCapacity;
+
+  void append( const MpIeee *x, const MpIeee *y, int negate );
+  MpIeee& roundExact( MpIeee& result ) const;
+  MpIeee& roundUnfused( MpIeee& result ) const;
+
+  static sign termSign( const Term& t );
+  static void addAt( Digit *buf, unsigned int at, const Digit *src,
+		     unsigned int n, Digit radix );
+
+  MpFusedSum( const MpFusedSum& );     // not copyable
+  void operator=( const MpFusedSum& ); // not assignable
+};
+
+#ifndef OUTLINE
+#include "MpFused.icc"
+#endif
+
+#endif /* _ARITHMOS_MPFUSED_H_ */
@@ -41,6 +41,8 @@
 #include <limits.h>
 #include <math.h>
 #include <FPEnv.hh>
+#include <MpDigits.hh>
+#include <MpPool.hh>
 #include <SpecialRounded.hh>
 
 #ifndef _WINDOWS_MSVC_
@@ -51,6 +53,19 @@
 #define ulonglong unsigned __int64
 #endif
 
+/*
+ * Move constructors and move assignments need C++11 rvalue
+ * references.  Without them, the Tmp classes still take care of
+ * temporaries.
+ */
+#if !defined(ARITHMOS_RVALUE_REFS) && (__cplusplus >= 201103L || \
+    (defined(_MSC_VER) && _MSC_VER >= 1600))
+#define ARITHMOS_RVALUE_REFS
+#endif
+#ifdef ARITHMOS_RVALUE_REFS
+#include <utility>
+#endif
+
 #if defined log2
 #undef log2
 #endif
@@ -75,10 +90,26 @@ typedef enum signs {plus = 0,minus = 1} sign;
 
 /**
  ** @brief   max. nr. of chars for decimal input strings
- ** @remark  also max. decimal exponent 10^e
+ ** @remark  also max. decimal exponent 10^e; MpDecimal::fromDecimal()
+ **          has no such limits
  **/
 #define maxstr 5000
 
+/**
+ ** @brief   max. nr. of digits stored inside the MpIeee object itself
+ ** @remark  Significands with more digits are allocated from the MpPool.
+ **          The buffer is part of every MpIeee, heap significands
+ **          included, so the default is 0: no buffer at all.  A program
+ **          whose numbers mostly have at most a few digits can define
+ **          it, like ARITHMOS_LIMB_DIGITS, on the command line of every
+ **          translation unit and of the library.  Fixed small formats
+ **          are better served by MpIeeeN, which holds exactly its own
+ **          digits.
+ **/
+#ifndef MPIEEE_INLINE_DIGITS
+#define MPIEEE_INLINE_DIGITS 0
+#endif
+
 // foreward declarations of four :-) stand-alone inline functions
 
 int PrecisionMismatch();
@@ -95,9 +126,19 @@ class TmpMpIeee; // forward declaration
  **/
 class MpIeee {
   friend class TmpMpIeee;
+  friend class MpFusedSum;
+  friend class MpAccumulator;
+  friend class MpConstants;
+  friend class MpBinarySplit;
+  friend class MpSeries;
+  friend class MpAgm;
+  friend class MpDouble;
+  friend class MpMultiDouble;
+  friend class MpDecimal;
+  friend class MpRound;
 
 public:
-  static class FPEnv fpEnv; ///< floating-point environment
+  static class ThreadFPEnv fpEnv; ///< environment of the calling thread
 
   /**
    ** @name Constructors
@@ -131,6 +172,9 @@ public:
   MpIeee( SpecialValue s, unsigned int prec, int l, int u );
   MpIeee( const MpIeee& R );
   MpIeee( TmpMpIeee& T );
+#ifdef ARITHMOS_RVALUE_REFS
+  MpIeee( MpIeee&& R );
+#endif
   /*@}*/
   
   /// destructor
@@ -145,6 +189,9 @@ public:
   /*@{*/
   void operator= ( const MpIeee& R );
   void operator= ( TmpMpIeee& T );
+#ifdef ARITHMOS_RVALUE_REFS
+  void operator= ( MpIeee&& R );
+#endif
   void operator= ( int i );
   void operator= ( unsigned int i );
   void operator= ( long i );
@@ -169,7 +216,9 @@ public:
   /*@{*/ 
   friend TmpMpIeee operator+ ( const MpIeee& X, const MpIeee& Y);
   friend TmpMpIeee operator- ( const MpIeee& X, const MpIeee& Y);
+#ifndef ARITHMOS_EXPR_TEMPLATES
   friend TmpMpIeee operator* ( const MpIeee& X, const MpIeee& Y);
+#endif
   friend TmpMpIeee operator* ( const MpIeee& X, const int i );
   friend TmpMpIeee operator/ ( const MpIeee& X, const MpIeee& Y );
   friend TmpMpIeee operator% ( const MpIeee& X, const MpIeee& Y );
@@ -183,6 +232,22 @@ public:
   static MpIeee& mul ( const MpIeee& op1, const MpIeee& op2, MpIeee& result );
   static MpIeee& div ( const MpIeee& op1, const MpIeee& op2, MpIeee& result );
 
+  static MpIeee& add ( const MpIeee& op1, const MpIeee& op2, MpIeee& result,
+		       FP_Rnd rounding, FP_Excep& flags );
+  static MpIeee& sub ( const MpIeee& op1, const MpIeee& op2, MpIeee& result,
+		       FP_Rnd rounding, FP_Excep& flags );
+  static MpIeee& mul ( const MpIeee& op1, const MpIeee& op2, MpIeee& result,
+		       FP_Rnd rounding, FP_Excep& flags );
+  static MpIeee& div ( const MpIeee& op1, const MpIeee& op2, MpIeee& result,
+		       FP_Rnd rounding, FP_Excep& flags );
+
+  static MpIeee& fma ( const MpIeee& op1, const MpIeee& op2,
+		       const MpIeee& op3, MpIeee& result );
+  static MpIeee& fms ( const MpIeee& op1, const MpIeee& op2,
+		       const MpIeee& op3, MpIeee& result );
+  static MpIeee& dot ( const MpIeee *x, const MpIeee *y, unsigned int n,
+		       MpIeee& result );
+
 
   friend void divJohan( MpIeee& c, const MpIeee& a, const MpIeee& b );
   /*@}*/
@@ -359,8 +424,19 @@ protected:
   int           mpExponent;     // exponent value
   Digit        *mpSignificand;  // pointer to significand digits
   unsigned int  mpPrecision;    // number of digits
+  MpPoolBlock   mpBlock;        // mpSignificand, if from the MpPool
+#if MPIEEE_INLINE_DIGITS > 0
+  Digit         mpInline[MPIEEE_INLINE_DIGITS + 1]; // small significands
+#endif
 
   static void iCopy(const Digit *src, Digit *dst, int n);
+  int isInline() const;
+  Digit *inlineSignificand();
+  static void freeDigits(Digit *d, const MpPoolBlock &block);
+  void allocSignificand(unsigned int prec);
+  void freeSignificand();
+  void reallocSignificand(unsigned int newPrec);
+  void takeSignificand(MpIeee &T);
   unsigned int fillPrecStack(unsigned int prec,unsigned int *nstack);
 
   // void pow(const MpIeee &X,long unsigned int e); // X^e
@@ -380,6 +456,14 @@ protected:
 
   void dRound(unsigned int precision, Digit ulps);
 
+  // exact results rounded once in a given mode, exceptions returned
+  static FP_Excep addRounded(const MpIeee &X, const MpIeee &Y, int negate,
+			     MpIeee &result, FP_Rnd rounding);
+  static FP_Excep mulRounded(const MpIeee &X, const MpIeee &Y,
+			     MpIeee &result, FP_Rnd rounding);
+  static FP_Excep divRounded(const MpIeee &X, const MpIeee &Y,
+			     MpIeee &result, FP_Rnd rounding);
+
   double toDigit() const;
 
   void sqroot(const MpIeee &X);
@@ -438,12 +522,77 @@ TmpMpIeee next(MpIeee &X);
 TmpMpIeee poweri(const MpIeee &X,int i);
 TmpMpIeee neg(MpIeee &X);
 
+/**
+ ** @name Explicit rounding
+ **
+ ** Like the functions above, but rounded in the given mode instead of
+ ** the one of MpIeee::fpEnv.  The exceptions they raise are added to
+ ** flags, the environment of the calling thread is left unchanged.
+ ** The static MpIeee::add, sub, mul and div have the same overloads.
+ ** All but sqrt are evaluated by MpSeries and MpAgm, and are defined
+ ** with them in MpSeries.hh.
+ **/
+/*@{*/
+TmpMpIeee acos( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee acotan( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee arcosh( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee arcotanh( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee arsinh( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee artanh( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee asin( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee atan( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee cos( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee cosh( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee cotan( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee exp( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee exp2( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee exp10( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee ln( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee log2( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee log10( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee sin( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee sinh( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee sqrt( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee tan( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee tanh( const MpIeee& X, FP_Rnd rounding, FP_Excep& flags );
+TmpMpIeee pow( const MpIeee& X, const MpIeee& Y, FP_Rnd rounding,
+	       FP_Excep& flags );
+/*@}*/
+
+#ifdef ARITHMOS_RVALUE_REFS
+/**
+ ** @name Arithmetic on rvalues
+ **
+ ** These overloads compute the result in the significand of an
+ ** rvalue operand, so a chained expression like a*b + c*d - e
+ ** allocates only the significands of its two products.
+ **/
+/*@{*/
+TmpMpIeee operator+ ( MpIeee&& X, const MpIeee& Y );
+TmpMpIeee operator+ ( const MpIeee& X, MpIeee&& Y );
+TmpMpIeee operator+ ( MpIeee&& X, MpIeee&& Y );
+TmpMpIeee operator- ( MpIeee&& X, const MpIeee& Y );
+TmpMpIeee operator* ( MpIeee&& X, const MpIeee& Y );
+TmpMpIeee operator* ( const MpIeee& X, MpIeee&& Y );
+TmpMpIeee operator* ( MpIeee&& X, MpIeee&& Y );
+TmpMpIeee operator/ ( MpIeee&& X, const MpIeee& Y );
+TmpMpIeee neg( MpIeee&& X );
+TmpMpIeee abs( MpIeee&& X );
+/*@}*/
+#endif
+
 MpIeee e(unsigned int newprec);  // return e
 MpIeee one(unsigned int newprec); // return 1
 MpIeee ln10(unsigned int newprec);
 MpIeee lnradix();
 
 #include "TmpMpIeee.hh"
+#include "MpRound.hh"
+#include "MpFused.hh"
+#include "MpDouble.hh"
+#ifdef ARITHMOS_EXPR_TEMPLATES
+#include "MpIeeeExpr.hh"
+#endif
 
 #ifndef OUTLINE
 #include "MpIeee.icc"
@@ -0,0 +1,250 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpIeeeExpr : Expression templates for fused MpIeee arithmetic
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpIeeeExpr.hh
+ ** @brief    Expression templates for fused MpIeee arithmetic
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** When ARITHMOS_EXPR_TEMPLATES is defined, the product of two MpIeees
+ ** is not computed right away, but returns a MpProdExpr.  Sums and
+ ** differences of products and MpIeees build bigger expressions, which
+ ** are evaluated by a MpFusedSum when they are converted to a
+ ** TmpMpIeee.  So a*b + c is a fused multiply-add, and a*b - c*d or
+ ** a*b + c*d + e*f are rounded only once.
+ **
+ ** Expressions only refer to their operands: convert them before the
+ ** end of the statement, and do not keep them in variables.
+ **/
+
+#ifndef _ARITHMOS_MPIEEEEXPR_H_
+#define _ARITHMOS_MPIEEEEXPR_H_
+
+#include <MpIeee.hh>
+
+/**
+ ** @brief Base of all MpIeee expressions.
+ **
+ ** E is the actual expression class, which provides
+ **  - collect( s, negate ), adding its terms to the MpFusedSum s,
+ **  - format(), a MpIeee that determines the format of the result,
+ **  - evaluate( result ), rounding its value into result.
+ **/
+template <class E>
+class MpExpr {
+public:
+  const E& self() const { return static_cast<const E&>( *this ); }
+
+  /// Evaluate the expression, rounding only once
+  operator TmpMpIeee() const
+  {
+    TmpMpIeee result( self().format() );
+    self().evaluate( result );
+    return result;
+  }
+};
+
+/**
+ ** @brief A single MpIeee inside a sum.
+ **/
+class MpTermExpr : public MpExpr<MpTermExpr> {
+public:
+  MpTermExpr( const MpIeee& x ) : mX( x ) {}
+
+  void collect( MpFusedSum& s, int negate ) const { s.addTerm( mX, negate ); }
+  const MpIeee& format() const { return mX; }
+  void evaluate( MpIeee& result ) const { MpIeee::fastAssign( mX, result ); }
+
+private:
+  const MpIeee& mX;
+};
+
+/**
+ ** @brief The exact product of two MpIeees.
+ **/
+class MpProdExpr : public MpExpr<MpProdExpr> {
+public:
+  MpProdExpr( const MpIeee& x, const MpIeee& y ) : mX( x ), mY( y ) {}
+
+  void collect( MpFusedSum& s, int negate ) const
+  {
+    s.addProduct( mX, mY, negate );
+  }
+  const MpIeee& format() const { return mX; }
+
+  /// A product on its own is an ordinary multiplication.
+  void evaluate( MpIeee& result ) const { MpIeee::mul( mX, mY, result ); }
+
+private:
+  const MpIeee& mX;
+  const MpIeee& mY;
+};
+
+/**
+ ** @brief Sum (or difference) of two expressions.
+ **/
+template <class A, class B>
+class MpSumExpr : public MpExpr< MpSumExpr<A, B> > {
+public:
+  MpSumExpr( const A& a, const B& b, int subtract ) :
+    mA( a ), mB( b ), mSubtract( subtract ) {}
+
+  void collect( MpFusedSum& s, int negate ) const
+  {
+    mA.collect( s, negate );
+    mB.collect( s, negate ^ mSubtract );
+  }
+  const MpIeee& format() const { return mA.format(); }
+  void evaluate( MpIeee& result ) const
+  {
+    MpFusedSum s;
+    collect( s, 0 );
+    s.roundTo( result );
+  }
+
+private:
+  A mA;
+  B mB;
+  int mSubtract;
+};
+
+/**
+ ** @brief Negated expression.
+ **/
+template <class A>
+class MpNegExpr : public MpExpr< MpNegExpr<A> > {
+public:
+  MpNegExpr( const A& a ) : mA( a ) {}
+
+  void collect( MpFusedSum& s, int negate ) const { mA.collect( s, !negate ); }
+  const MpIeee& format() const { return mA.format(); }
+  void evaluate( MpIeee& result ) const
+  {
+    MpFusedSum s;
+    collect( s, 0 );
+    s.roundTo( result );
+  }
+
+private:
+  A mA;
+};
+
+/**
+ ** @name Building expressions
+ **/
+/*@{*/
+inline MpProdExpr operator* ( const MpIeee& X, const MpIeee& Y )
+{
+  return MpProdExpr( X, Y );
+}
+
+template <class A, class B>
+inline MpSumExpr<A, B> operator+ ( const MpExpr<A>& a, const MpExpr<B>& b )
+{
+  return MpSumExpr<A, B>( a.self(), b.self(), 0 );
+}
+
+template <class A>
+inline MpSumExpr<A, MpTermExpr> operator+ ( const MpExpr<A>& a,
+					    const MpIeee& Y )
+{
+  return MpSumExpr<A, MpTermExpr>( a.self(), MpTermExpr( Y ), 0 );
+}
+
+template <class B>
+inline MpSumExpr<MpTermExpr, B> operator+ ( const MpIeee& X,
+					    const MpExpr<B>& b )
+{
+  return MpSumExpr<MpTermExpr, B>( MpTermExpr( X ), b.self(), 0 );
+}
+
+template <class A, class B>
+inline MpSumExpr<A, B> operator- ( const MpExpr<A>& a, const MpExpr<B>& b )
+{
+  return MpSumExpr<A, B>( a.self(), b.self(), 1 );
+}
+
+template <class A>
+inline MpSumExpr<A, MpTermExpr> operator- ( const MpExpr<A>& a,
+					    const MpIeee& Y )
+{
+  return MpSumExpr<A, MpTermExpr>( a.self(), MpTermExpr( Y ), 1 );
+}
+
+template <class B>
+inline MpSumExpr<MpTermExpr, B> operator- ( const MpIeee& X,
+					    const MpExpr<B>& b )
+{
+  return MpSumExpr<MpTermExpr, B>( MpTermExpr( X ), b.self(), 1 );
+}
+
+template <class A>
+inline MpNegExpr<A> operator- ( const MpExpr<A>& a )
+{
+  return MpNegExpr<A>( a.self() );
+}
+/*@}*/
+
+/**
+ ** @name Leaving expressions
+ **
+ ** Products and quotients of expressions are not fused: the
+ ** expression is rounded first.
+ **/
+/*@{*/
+template <class A>
+inline TmpMpIeee operator* ( const MpExpr<A>& a, const MpIeee& Y )
+{
+  TmpMpIeee X( a );
+  return X *= Y, X;
+}
+
+template <class B>
+inline TmpMpIeee operator* ( const MpIeee& X, const MpExpr<B>& b )
+{
+  TmpMpIeee Y( b );
+  return Y *= X, Y;
+}
+
+template <class A, class B>
+inline TmpMpIeee operator* ( const MpExpr<A>& a, const MpExpr<B>& b )
+{
+  TmpMpIeee X( a );
+  TmpMpIeee Y( b );
+  return X *= Y, X;
+}
+
+template <class A>
+inline TmpMpIeee operator/ ( const MpExpr<A>& a, const MpIeee& Y )
+{
+  TmpMpIeee X( a );
+  return X /= Y, X;
+}
+
+template <class B>
+inline TmpMpIeee operator/ ( const MpIeee& X, const MpExpr<B>& b )
+{
+  TmpMpIeee Y( b );
+  return TmpMpIeee( X / Y );
+}
+/*@}*/
+
+#endif /* _ARITHMOS_MPIEEEEXPR_H_ */
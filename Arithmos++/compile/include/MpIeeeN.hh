@@ -0,0 +1,325 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpIeeeN : Multiprecision floating-point numbers of a fixed format
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpIeeeN.hh
+ ** @brief    Multiprecision floating-point numbers of a fixed format
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** MpIeeeN<Prec, L, U> is a MpIeee whose precision and exponent range
+ ** are template arguments.  The significand lives in the object, the
+ ** digit loops have a trip count known at compile time (and are
+ ** unrolled for short formats), and two MpIeeeNs of the same type can
+ ** never have a precision mismatch.  The radix and the rounding mode
+ ** still come from MpIeee::fpEnv.
+ **
+ ** Conversions from and to the dynamic MpIeee class are explicit:
+ ** MpIeeeN<Prec, L, U>( X ) rounds a MpIeee of any precision into the
+ ** fixed format, and toMpIeee() returns a MpIeee( Prec, L, U ) with
+ ** the same value.
+ **/
+
+/*
+ * Some notes on the representation.
+ *
+ * It is the representation of MpIeee: digits mpSignificand[1..Prec],
+ * most significant first, stand for 0.d1d2...dPrec * radix^exponent.
+ * Zeros have exponent L - 1, infinities and NaNs exponent U + 1 with a
+ * zero resp. nonzero first digit.  Denormals have exponent L and a
+ * leading zero digit.  Unlike MpIeee, the significand of an infinity
+ * is all zero, and only the IEEE special values are supported.
+ *
+ * Formats of at most 53 bits in radix 2^b, single and double among
+ * them, add, subtract, multiply and divide with the MpDouble kernels;
+ * formats of up to 212 bits multiply and divide with the MpMultiDouble
+ * kernels.
+ */
+
+#ifndef _ARITHMOS_MPIEEEN_H_
+#define _ARITHMOS_MPIEEEN_H_
+
+#include <MpIeee.hh>
+
+/**
+ ** @brief   max. nr. of digits for which the digit loops are unrolled
+ ** @remark  Longer arrays use the MpDigits kernels.
+ **/
+#ifndef MPIEEEN_UNROLL_LIMIT
+#define MPIEEEN_UNROLL_LIMIT 16
+#endif
+
+/**
+ ** @brief Linear kernels on N digits, unrolled at compile time.
+ **
+ ** Same interface as the corresponding MpDigits kernels.  Digit N - 1
+ ** is handled first, then the remaining N - 1 digits.
+ **/
+template <unsigned int N>
+class MpUnrolled {
+public:
+  static Digit add( Digit *z, const Digit *x, const Digit *y, Digit c,
+		    Digit radix )
+  {
+    Digit s = x[N - 1] + y[N - 1] + c;
+
+    if (s >= radix) {
+      z[N - 1] = s - radix;
+      c = 1;
+    }
+    else {
+      z[N - 1] = s;
+      c = 0;
+    }
+    return MpUnrolled<N - 1>::add( z, x, y, c, radix );
+  }
+
+  static Digit sub( Digit *z, const Digit *x, const Digit *y, Digit b,
+		    Digit radix )
+  {
+    Digit t = y[N - 1] + b;
+
+    if (x[N - 1] < t) {
+      z[N - 1] = x[N - 1] + radix - t;
+      b = 1;
+    }
+    else {
+      z[N - 1] = x[N - 1] - t;
+      b = 0;
+    }
+    return MpUnrolled<N - 1>::sub( z, x, y, b, radix );
+  }
+
+  static Digit addMul1( Digit *z, const Digit *x, Digit d, Digit c,
+			Digit radix )
+  {
+    MpDigits::split( (DoubleDigit) x[N - 1] * d + z[N - 1] + c, radix,
+		     c, z[N - 1] );
+    return MpUnrolled<N - 1>::addMul1( z, x, d, c, radix );
+  }
+
+  static void copy( Digit *z, const Digit *x )
+  {
+    z[N - 1] = x[N - 1];
+    MpUnrolled<N - 1>::copy( z, x );
+  }
+
+  static void zero( Digit *z )
+  {
+    z[N - 1] = 0;
+    MpUnrolled<N - 1>::zero( z );
+  }
+};
+
+template <>
+class MpUnrolled<0> {
+public:
+  static Digit add( Digit *, const Digit *, const Digit *, Digit c, Digit )
+  { return c; }
+  static Digit sub( Digit *, const Digit *, const Digit *, Digit b, Digit )
+  { return b; }
+  static Digit addMul1( Digit *, const Digit *, Digit, Digit c, Digit )
+  { return c; }
+  static void copy( Digit *, const Digit * ) {}
+  static void zero( Digit * ) {}
+};
+
+/**
+ ** @brief Kernels on N digit arrays.
+ **
+ ** Unrolled up to MPIEEEN_UNROLL_LIMIT digits, longer arrays go to
+ ** the MpDigits kernels.
+ **/
+template <unsigned int N, int Unroll = (N <= MPIEEEN_UNROLL_LIMIT)>
+class MpFixedDigits {
+public:
+  static Digit add( Digit *z, const Digit *x, const Digit *y, Digit radix )
+  { return MpUnrolled<N>::add( z, x, y, 0, radix ); }
+
+  static Digit sub( Digit *z, const Digit *x, const Digit *y, Digit radix )
+  { return MpUnrolled<N>::sub( z, x, y, 0, radix ); }
+
+  static void copy( Digit *z, const Digit *x ) { MpUnrolled<N>::copy( z, x ); }
+  static void zero( Digit *z ) { MpUnrolled<N>::zero( z ); }
+
+  /// z[0..2N-1] = x * y, each row unrolled
+  static void mul( Digit *z, const Digit *x, const Digit *y, Digit radix )
+  {
+    MpUnrolled<N>::zero( z + N );
+    for (unsigned int i = N; i-- > 0; )
+      z[i] = MpUnrolled<N>::addMul1( z + i + 1, x, y[i], 0, radix );
+  }
+};
+
+template <unsigned int N>
+class MpFixedDigits<N, 0> {
+public:
+  static Digit add( Digit *z, const Digit *x, const Digit *y, Digit radix )
+  { return MpDigits::add( z, x, y, N, radix ); }
+
+  static Digit sub( Digit *z, const Digit *x, const Digit *y, Digit radix )
+  { return MpDigits::sub( z, x, y, N, radix ); }
+
+  static void copy( Digit *z, const Digit *x ) { MpDigits::copy( z, x, N ); }
+  static void zero( Digit *z ) { MpDigits::zero( z, N ); }
+
+  static void mul( Digit *z, const Digit *x, const Digit *y, Digit radix )
+  { MpDigits::mul( z, x, N, y, N, radix ); }
+};
+
+/**
+ ** @brief Multiprecision floating-point number of a fixed format.
+ **
+ ** Prec digits in the radix of MpIeee::fpEnv, exponents from L to U.
+ **/
+template <unsigned int Prec, int L, int U>
+class MpIeeeN {
+
+public:
+  /**
+   ** @name Constructors
+   **
+   ** The default constructor assigns +0.
+   **/
+  /*@{*/
+  MpIeeeN();
+  explicit MpIeeeN( int i );
+  explicit MpIeeeN( const MpIeee& X );
+  /*@}*/
+
+  /// Conversion to a MpIeee( Prec, L, U ).
+  MpIeee toMpIeee() const;
+
+  /**
+   ** @name Arithmetic
+   **
+   ** All results are rounded once, in the rounding mode of
+   ** MpIeee::fpEnv.  result may be one of the operands.
+   **/
+  /*@{*/
+  static MpIeeeN& add( const MpIeeeN& op1, const MpIeeeN& op2,
+		       MpIeeeN& result );
+  static MpIeeeN& sub( const MpIeeeN& op1, const MpIeeeN& op2,
+		       MpIeeeN& result );
+  static MpIeeeN& mul( const MpIeeeN& op1, const MpIeeeN& op2,
+		       MpIeeeN& result );
+  static MpIeeeN& div( const MpIeeeN& op1, const MpIeeeN& op2,
+		       MpIeeeN& result );
+
+  void operator+= ( const MpIeeeN& Y );
+  void operator-= ( const MpIeeeN& Y );
+  void operator*= ( const MpIeeeN& Y );
+  void operator/= ( const MpIeeeN& Y );
+  MpIeeeN operator-() const;
+  void neg();
+  /*@}*/
+
+  /// Compare: -1, 0 or 1, or 2 if unordered.
+  static int compare( const MpIeeeN& X, const MpIeeeN& Y );
+
+  /**
+   ** @name Special representations
+   **/
+  /*@{*/
+  int isZero() const;
+  void setZero( sign newsign );
+  int isInf() const;
+  void setInf( sign newsign );
+  int isNan() const;
+  void setNan();
+  void setMax( sign s );
+  /*@}*/
+
+  /**
+   ** @name Sign, mantissa and exponent
+   **/
+  /*@{*/
+  sign getSign() const;
+  int getExp() const;
+  static unsigned int prec() { return Prec; }
+  static int getL() { return L; }
+  static int getU() { return U; }
+  Digit operator[]( unsigned int i ) const;
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  sign  mpSign;                     // sign
+  int   mpExponent;                 // exponent value
+  Digit mpSignificand[Prec + 1];    // digits 1..Prec
+
+  void roundFrom( const Digit *w, unsigned int n, long e, sign s,
+		  int sticky );
+  long normalized( Digit *d ) const;
+  int cmpAbs( const MpIeeeN& Y ) const;
+  void addAbs( const MpIeeeN& X, const MpIeeeN& Y, sign s, int subtract );
+  static MpIeeeN& addSigned( const MpIeeeN& X, const MpIeeeN& Y, sign sy,
+			     MpIeeeN& result );
+  double unpack( long& e, unsigned int b ) const;
+  void roundDouble( const MpDouble::Exact& r, unsigned int b );
+  int expansion( double *x, long& e, unsigned int b ) const;
+  void roundWide( const MpMultiDouble::Exact& r, unsigned int b );
+  int divWide( const MpIeeeN& op1, const MpIeeeN& op2, sign s );
+};
+
+/**
+ ** @name Operators
+ **/
+/*@{*/
+template <unsigned int P, int L, int U>
+MpIeeeN<P, L, U> operator+ ( const MpIeeeN<P, L, U>& X,
+			     const MpIeeeN<P, L, U>& Y );
+template <unsigned int P, int L, int U>
+MpIeeeN<P, L, U> operator- ( const MpIeeeN<P, L, U>& X,
+			     const MpIeeeN<P, L, U>& Y );
+template <unsigned int P, int L, int U>
+MpIeeeN<P, L, U> operator* ( const MpIeeeN<P, L, U>& X,
+			     const MpIeeeN<P, L, U>& Y );
+template <unsigned int P, int L, int U>
+MpIeeeN<P, L, U> operator/ ( const MpIeeeN<P, L, U>& X,
+			     const MpIeeeN<P, L, U>& Y );
+
+template <unsigned int P, int L, int U>
+int operator== ( const MpIeeeN<P, L, U>& X, const MpIeeeN<P, L, U>& Y );
+template <unsigned int P, int L, int U>
+int operator!= ( const MpIeeeN<P, L, U>& X, const MpIeeeN<P, L, U>& Y );
+template <unsigned int P, int L, int U>
+int operator<  ( const MpIeeeN<P, L, U>& X, const MpIeeeN<P, L, U>& Y );
+template <unsigned int P, int L, int U>
+int operator>  ( const MpIeeeN<P, L, U>& X, const MpIeeeN<P, L, U>& Y );
+template <unsigned int P, int L, int U>
+int operator<= ( const MpIeeeN<P, L, U>& X, const MpIeeeN<P, L, U>& Y );
+template <unsigned int P, int L, int U>
+int operator>= ( const MpIeeeN<P, L, U>& X, const MpIeeeN<P, L, U>& Y );
+
+template <unsigned int P, int L, int U>
+ostream& operator<< ( ostream& o, const MpIeeeN<P, L, U>& X );
+/*@}*/
+
+/*
+ * Templates cannot be compiled out of line, so the inline functions
+ * are always included.
+ */
+#include "MpIeeeN.icc"
+
+#endif /* _ARITHMOS_MPIEEEN_H_ */
@@ -0,0 +1,204 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpIeeeVector : Arrays of multiprecision floating-point numbers
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpIeeeVector.hh
+ ** @brief    Arrays of multiprecision floating-point numbers
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** A MpIeeeVector holds n numbers of one format (precision and
+ ** exponent range) in a few contiguous arrays instead of n MpIeee
+ ** objects with a significand each.  The arithmetic works on whole
+ ** vectors: the radix, the rounding mode and the work space are set
+ ** up once per call, the exceptions are signaled once at the end.
+ **/
+
+/*
+ * Some notes on the representation.
+ *
+ * The numbers are stored as structure of arrays: one array with the
+ * signs, one with the exponents, and the digit planes.  Plane i holds
+ * digit i of all numbers, so the digits of number k are
+ * mpPlanes[k], mpPlanes[n + k], mpPlanes[2n + k], ...  Exponents and
+ * special values are those of MpIeeeN: zero has exponent L - 1,
+ * infinity and NaN exponent U + 1 with a zero resp. nonzero first
+ * digit, denormals exponent L and a leading zero digit.
+ *
+ * The kernels gather the digits of one number into a contiguous
+ * buffer for the MpDigits kernels and scatter the rounded result
+ * back.  Consecutive numbers share the cache lines of every plane.
+ * Formats of at most 53 bits in radix 2^b skip the buffers: the
+ * MpDouble kernels read the planes and round into them directly, as
+ * do the MpMultiDouble kernels for products, quotients and roots of
+ * up to 212 bits.
+ */
+
+#ifndef _ARITHMOS_MPIEEEVECTOR_H_
+#define _ARITHMOS_MPIEEEVECTOR_H_
+
+#include <MpIeee.hh>
+
+/**
+ ** @brief Vector of multiprecision floating-point numbers.
+ **/
+class MpIeeeVector {
+
+public:
+  /**
+   ** @name Constructors
+   **
+   ** All elements are +0.  Without a format, the precision and the
+   ** exponent range of MpIeee::fpEnv are used.
+   **/
+  /*@{*/
+  MpIeeeVector( unsigned int n );
+  MpIeeeVector( unsigned int n, unsigned int prec, int l, int u );
+  MpIeeeVector( const MpIeeeVector& V );
+  /*@}*/
+
+  ~MpIeeeVector();
+
+  void operator= ( const MpIeeeVector& V );
+
+  /**
+   ** @name Format
+   **/
+  /*@{*/
+  unsigned int size() const;
+  unsigned int prec() const;
+  int getL() const;
+  int getU() const;
+  /*@}*/
+
+  /**
+   ** @name Elements
+   **
+   ** set() rounds X into the format of the vector.
+   **/
+  /*@{*/
+  void set( unsigned int k, const MpIeee& X );
+  MpIeee get( unsigned int k ) const;
+
+  int isZero( unsigned int k ) const;
+  void setZero( unsigned int k, sign newsign );
+  int isInf( unsigned int k ) const;
+  void setInf( unsigned int k, sign newsign );
+  int isNan( unsigned int k ) const;
+  void setNan( unsigned int k );
+  sign getSign( unsigned int k ) const;
+  int getExp( unsigned int k ) const;
+  Digit digit( unsigned int k, unsigned int i ) const; ///< i from 1
+  /*@}*/
+
+  /**
+   ** @name Elementwise arithmetic
+   **
+   ** result[k] = op1[k] op op2[k] for all k, rounded in the rounding
+   ** mode of MpIeee::fpEnv.  The vectors must have the same size and
+   ** format; result may be one of the operands.
+   **/
+  /*@{*/
+  static MpIeeeVector& add( const MpIeeeVector& op1,
+			    const MpIeeeVector& op2, MpIeeeVector& result );
+  static MpIeeeVector& sub( const MpIeeeVector& op1,
+			    const MpIeeeVector& op2, MpIeeeVector& result );
+  static MpIeeeVector& mul( const MpIeeeVector& op1,
+			    const MpIeeeVector& op2, MpIeeeVector& result );
+  static MpIeeeVector& div( const MpIeeeVector& op1,
+			    const MpIeeeVector& op2, MpIeeeVector& result );
+  static MpIeeeVector& sqrt( const MpIeeeVector& op, MpIeeeVector& result );
+  void neg();
+  /*@}*/
+
+  /// c[k] = -1, 0 or 1 as X[k] is less, equal or greater, 2 if unordered
+  static void compare( const MpIeeeVector& X, const MpIeeeVector& Y,
+		       int *c );
+
+  /**
+   ** @name Conversions
+   **
+   ** From and to arrays of size() elements.  The MpIeees of toMpIeee
+   ** get the format of the vector.
+   **/
+  /*@{*/
+  void fromInt( const int *a );
+  void fromMpIeee( const MpIeee *a );
+  void toMpIeee( MpIeee *a ) const;
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  int L;                      ///< minimal exponent
+  int U;                      ///< maximal exponent
+  unsigned int mpSize;        // number of elements
+  unsigned int mpPrecision;   // digits per element
+  sign  *mpSigns;             // sign of element k
+  int   *mpExponents;         // exponent of element k
+  Digit *mpPlanes;            // digit i + 1 of element k at [i n + k]
+
+  /*
+   * Set up once per vector operation.
+   */
+  struct Batch {
+    Digit radix;
+    FP_Rnd rounding;
+    FP_Excep flags;            // raised, signaled by finish()
+    Digit *digits;             // prec digits for roundInto()
+    Digit *work;               // for the kernel, from the MpPool
+    unsigned int size;         // nr. of digits of the two together
+    unsigned int bits;         // MpDouble::bits(), 0 for the digits
+    unsigned int wide;         // MpMultiDouble::bits()
+  };
+
+  void allocate( unsigned int n, unsigned int prec, int l, int u );
+  void start( Batch& b, unsigned int work ) const;
+  static void finish( Batch& b );
+  static int matches( const MpIeeeVector& X, const MpIeeeVector& Y );
+
+  void gather( unsigned int k, Digit *d ) const;
+  void scatter( unsigned int k, const Digit *d );
+  long normalized( unsigned int k, Digit *d ) const;
+  void copyElement( unsigned int k, const MpIeeeVector& X, sign s );
+  void setElement( unsigned int k, const MpIeee& X, Batch& b );
+  void roundInto( unsigned int k, const Digit *w, unsigned int n, long e,
+		  sign s, int sticky, Batch& b );
+  double unpack( unsigned int k, long& e, const Batch& b ) const;
+  void roundDouble( unsigned int k, const MpDouble::Exact& r, Batch& b );
+  int expansion( unsigned int k, double *x, long& e, const Batch& b ) const;
+  void roundWide( unsigned int k, const MpMultiDouble::Exact& r, Batch& b );
+  int divWide( unsigned int k, const MpIeeeVector& op1,
+	       const MpIeeeVector& op2, sign s, Batch& b );
+  int sqrtWide( unsigned int k, const MpIeeeVector& op, Batch& b );
+  int cmpAbs( unsigned int k, const MpIeeeVector& Y ) const;
+  void addAbs( unsigned int k, const MpIeeeVector& X,
+	       const MpIeeeVector& Y, sign s, int subtract, Batch& b );
+  void addSigned( unsigned int k, const MpIeeeVector& X,
+		  const MpIeeeVector& Y, sign sy, Batch& b );
+};
+
+#ifndef OUTLINE
+#include "MpIeeeVector.icc"
+#endif
+
+#endif /* _ARITHMOS_MPIEEEVECTOR_H_ */
@@ -0,0 +1,180 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpMultiDouble : Double-double and quad-double arithmetic
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpMultiDouble.hh
+ ** @brief    Double-double and quad-double arithmetic
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** Multiplication, division and square root for the formats just above
+ ** MpDouble: radix 2^b and 53 < b * prec <= 106 (double-double) or <=
+ ** 212 (quad-double).  The significands are taken as sums of two to
+ ** four doubles and the operations are done on these expansions with
+ ** error free transformations, instead of digit by digit; the result
+ ** is rounded once to the target format, with the rounding, exponent
+ ** range, denormals and exceptions of the digit kernels.  Addition
+ ** and subtraction, linear in the number of digits, stay with the
+ ** digit kernels.  The backend is chosen per format by its width:
+ ** setLimbs( 2 ) keeps the quad-double formats on the digit kernels,
+ ** setLimbs( 0 ) all of them.  MpDouble::setEnabled( 0 ) switches
+ ** these kernels off too.
+ **
+ ** MpIeeeVector and MpIeeeN use the kernels for such formats, MpIeee
+ ** through the MpDouble functions.
+ **
+ ** This file is included by MpDouble.hh, do not include it directly.
+ **/
+
+/*
+ * Some notes on the expansions.
+ *
+ * An expansion is a sum of doubles e[0] + e[1] + ... + e[n-1],
+ * nonoverlapping and in order of increasing magnitude (Shewchuk).
+ * The integer significand X of an operand, X 2^e with X < 2^212, is
+ * cut into chunks of 53 bits; the expansion of the product of two
+ * such operands is exact, by TwoSum and TwoProduct.
+ *
+ * A quotient or square root is first approximated by an expansion,
+ * one double per step, to well beyond the target precision.  This is
+ * truncated to an integer multiple N of a unit u far below the last
+ * digit, and the exact residual (X - N u Y, resp. X - (N u)^2) then
+ * tells if N u is the floor of the result and whether it is exact;
+ * if not, N is corrected by one unit, at most MPMULTIDOUBLE_STEPS
+ * times.  The residual of each step is compressed first: under
+ * cancellation its components are large and of both signs, and only
+ * after Compress is its largest one a good estimate of it.
+ *
+ * All results are rounded the same way: the expansion is added into
+ * an integer N of a few words, u = 2^e its last bit, with bp + 64 bits
+ * below the top, and the sign of the part below u is the tail; all
+ * that the rounding needs are the bits of N and that sign.
+ */
+
+#ifndef _ARITHMOS_MPMULTIDOUBLE_H_
+#define _ARITHMOS_MPMULTIDOUBLE_H_
+
+#ifndef MPMULTIDOUBLE_LIMBS
+#define MPMULTIDOUBLE_LIMBS 4   ///< doubles of the widest expansions, 0,
+                                ///< 2 or 4
+#endif
+
+#define MPMULTIDOUBLE_WORDS 6   ///< words of the integer N, with sign
+#define MPMULTIDOUBLE_TERMS 192 ///< doubles of the longest expansion
+#define MPMULTIDOUBLE_STEPS 4   ///< max. corrections of a quotient or root
+
+/**
+ ** @brief Double-double and quad-double arithmetic for mid-range formats.
+ **/
+class MpMultiDouble {
+
+public:
+  /**
+   ** Exact result of an operation: |result| = n 2^e, plus less than
+   ** 2^e above it (tail 1), below it (tail -1) or nothing (tail 0).
+   **/
+  struct Exact {
+    ulonglong n[MPMULTIDOUBLE_WORDS];
+    long e;
+    int tail;
+    sign sgn;
+  };
+
+  /**
+   ** @name Formats
+   **
+   ** bits( prec ) is b if the radix of MpIeee::fpEnv is 2^b, 53 < b
+   ** prec <= 53 getLimbs(), and MpDouble is enabled; 0 otherwise.
+   **/
+  /*@{*/
+  static unsigned int bits( unsigned int prec );
+  static unsigned int getLimbs();
+  static void setLimbs( unsigned int limbs );
+  /*@}*/
+
+  /**
+   ** @name Kernels
+   **
+   ** unpack() reads the prec digits d[0], d[stride], ... of a finite
+   ** number with the given exponent as the expansion x[0..n-1] times
+   ** 2^e, and returns n; at most 4 doubles, none for zero.  The
+   ** operations take such operands, nonzero, with bp = b prec, and
+   ** round() stores the result like MpDouble::round().  quotient() and
+   ** root() return 0 in the rare case that the estimate is too far off
+   ** to be corrected in MPMULTIDOUBLE_STEPS units; the digit kernels
+   ** have to do those.
+   **/
+  /*@{*/
+  static int unpack( const Digit *d, unsigned int stride, unsigned int prec,
+		     int exponent, unsigned int b, double *x, long& e );
+  static void product( const double *x, int nx, long ex,
+		       const double *y, int ny, long ey, sign s,
+		       unsigned int bp, Exact& r );
+  static int quotient( const double *x, int nx, long ex,
+		       const double *y, int ny, long ey, sign s,
+		       unsigned int bp, Exact& r );
+  static int root( const double *x, int nx, long ex, unsigned int bp,
+		   Exact& r );
+  static FP_Excep round( const Exact& r, unsigned int b, unsigned int prec,
+			 int l, int u, FP_Rnd rounding, Digit *d,
+			 unsigned int stride, int& exponent, sign& s );
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  static unsigned int& limbs();
+
+  static int grow( double *e, int n, double b );
+  static int add( double *e, int n, const double *f, int m );
+  static int scale( const double *e, int n, double b, double *h );
+  static int mulAdd( double *r, int nr, const double *e, int n,
+		     const double *f, int m, double c );
+  static int compress( double *e, int n );
+  static double approx( const double *e, int n );
+  static int signOf( const double *e, int n );
+
+  static void toWords( const double *e, int n, unsigned int bp,
+		       Exact& r );
+  static int fromWords( const ulonglong *w, long e, double *h );
+  static void increment( ulonglong *w, unsigned int n );
+  static void decrement( ulonglong *w, unsigned int n );
+  static int bit( const ulonglong *w, long i );
+  static int anyBelow( const ulonglong *w, long i );
+  static unsigned long top( const ulonglong *w );
+  static void shiftRight( const ulonglong *w, long s, ulonglong *m );
+  static int floor( const double *x, int nx, const double *y, int ny,
+		    unsigned int bp, const double *q, int nq, Exact& r );
+
+  static int binary( char op, const MpIeee& op1, const MpIeee& op2,
+		     MpIeee& result, FP_Rnd rounding, FP_Excep& flags );
+  static int sqrt( const MpIeee& op, MpIeee& result, FP_Rnd rounding,
+		   FP_Excep& flags );
+
+  friend class MpDouble;
+};
+
+#ifndef OUTLINE
+#include "MpMultiDouble.icc"
+#endif
+
+#endif /* _ARITHMOS_MPMULTIDOUBLE_H_ */
@@ -0,0 +1,153 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpParallel : Multithreaded, reproducible MpIeee reductions
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpParallel.hh
+ ** @brief    Multithreaded, reproducible MpIeee reductions
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** Sums, dot products and Euclidean norms of long MpIeee arrays,
+ ** computed by several threads.  Every thread adds its part of the
+ ** terms into its own MpAccumulator; these exact partial sums are
+ ** added together and rounded once.  The result is therefore the same,
+ ** to the last digit, for any number of threads.
+ **/
+
+/*
+ * Some notes on the threads.
+ *
+ * The terms are split into contiguous ranges of at least
+ * MPPARALLEL_GRAIN terms, one task per range.  The calling thread
+ * does the first task itself and hands the others to a pool of
+ * worker threads, which are started when they are first needed and
+ * then wait for the next reduction; tasks no worker has taken yet
+ * are done by the caller as well.  Each worker runs a task in a copy
+ * of the environment of the caller, and the exceptions it raises are
+ * signaled in the caller's environment at the end.  One reduction
+ * uses the pool at a time.
+ *
+ * POSIX threads are used, or Win32 threads with _WINDOWS_MSVC_.
+ * With ARITHMOS_NO_THREADS everything runs in the calling thread.
+ */
+
+#ifndef _ARITHMOS_MPPARALLEL_H_
+#define _ARITHMOS_MPPARALLEL_H_
+
+#include <MpAccumulator.hh>
+#include <MpThreads.hh>
+
+/**
+ ** @name	Parallel reduction parameters
+ **/
+/*@{*/
+#ifndef MPPARALLEL_GRAIN
+#define MPPARALLEL_GRAIN 4096  ///< min. nr. of terms per thread
+#endif
+#ifndef MPPARALLEL_THREADS
+#define MPPARALLEL_THREADS 0   ///< default nr. of threads, 0: nr. of CPUs
+#endif
+/*@}*/
+
+/**
+ ** @brief Reproducible parallel reductions of MpIeee arrays.
+ **
+ ** The result gives the format; the factors of the products must
+ ** have at most its precision, as for MpAccumulator.
+ **/
+class MpParallel {
+
+public:
+  /**
+   ** @name Reductions
+   **/
+  /*@{*/
+  static MpIeee& sum( const MpIeee *x, unsigned long n, MpIeee& result );
+  static MpIeee& dot( const MpIeee *x, const MpIeee *y, unsigned long n,
+		      MpIeee& result );
+  static MpIeee& norm2( const MpIeee *x, unsigned long n, MpIeee& result );
+  /*@}*/
+
+  /**
+   ** @name Number of threads
+   **
+   ** setThreads( 0 ) uses one thread per CPU.
+   **/
+  /*@{*/
+  static unsigned int getThreads();
+  static void setThreads( unsigned int n );
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  typedef enum MpParallel_Kind { MP_SUM, MP_DOT } kind;
+
+  struct Task {
+    kind what;
+    const MpIeee *x;
+    const MpIeee *y;
+    unsigned long lo, hi;     // terms lo..hi-1
+    MpAccumulator *acc;
+    FPEnv env;                // environment of the caller
+    FP_Excep flags;           // raised by the worker
+  };
+
+  static unsigned int& threads();
+  static unsigned int cpus();
+  static void run( Task& t );
+  static void work( Task& t );
+
+#if defined(MPTHREADS_PTHREAD) || defined(MPTHREADS_WIN32)
+  struct Pool {
+    MpMutex busy;             // held by the running reduction
+    MpMutex lock;             // protects the rest
+    MpCondition wake;         // new tasks
+    MpCondition done;         // all tasks finished
+    unsigned int workers;     // nr. of worker threads started
+    Task *tasks;              // of the running reduction
+    unsigned long count;      // nr. of tasks
+    unsigned long next;       // first task not taken
+    unsigned long pending;    // tasks 1..count-1 not finished
+
+    Pool();
+  };
+
+  static Pool& pool();
+  static int startWorker();
+  static void serve();
+#if defined(MPTHREADS_PTHREAD)
+  static void *entry( void * );
+#else
+  static DWORD WINAPI entry( LPVOID );
+#endif
+#endif
+
+  static void reduce( kind what, const MpIeee *x, const MpIeee *y,
+		      unsigned long n, MpAccumulator& acc );
+};
+
+#ifndef OUTLINE
+#include "MpParallel.icc"
+#endif
+
+#endif /* _ARITHMOS_MPPARALLEL_H_ */
@@ -0,0 +1,215 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpPool : Pooled allocation of MpIeee significands
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpPool.hh
+ ** @brief    Pooled allocation of MpIeee significands
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** Every thread has a MpPool that keeps freed significands, sorted
+ ** in size classes, for the next MpIeee of about the same precision.
+ ** Within an MpArena it keeps all of them, however many, so a
+ ** computation only calls new for its peak working set; they are
+ ** released together when the arena goes out of scope.
+ **/
+
+/*
+ * Some notes on the blocks.
+ *
+ * A request for n digits gets a block of size class k, the n rounded
+ * up to k * MPPOOL_GRAIN digits; n beyond MPPOOL_CLASSES classes gets
+ * exactly n digits and is never pooled.  release() is given the same
+ * n, so a block carries no header.  Every block is a plain new [] of
+ * its digits: a block allocated by one thread can be released by
+ * another, it never depends on the arena it was used in, and delete []
+ * frees it anywhere, also in code that does not know the pool.
+ * MpIeee records in an MpPoolBlock which significand came from the
+ * pool; any other one, such as a new [] of code that predates the
+ * pool, is freed with delete [].
+ *
+ * The free blocks beyond MPPOOL_DEPTH that an arena keeps are chained
+ * through their first digits.
+ *
+ * The thread-local storage holds only a pointer to the pool of the
+ * thread, which has no destructor, so no code running late in an
+ * exiting thread can reach a destroyed pool.  The pool is deleted
+ * explicitly when the thread exits: by a key destructor under POSIX
+ * threads, by a thread_local guard with C++11 elsewhere, and at
+ * program exit without threads.  After that the thread allocates and
+ * frees its blocks with new and delete.  The pool of the initial
+ * thread, and of every thread on compilers with none of these, stays
+ * allocated; trim() gives its free blocks back.
+ */
+
+#ifndef _ARITHMOS_MPPOOL_H_
+#define _ARITHMOS_MPPOOL_H_
+
+#include <FPEnv.hh>
+#include <string.h>
+#if defined(ARITHMOS_NO_THREADS)
+#include <stdlib.h>
+#endif
+
+/**
+ ** @name	Pool parameters
+ **/
+/*@{*/
+#ifndef MPPOOL_GRAIN
+#define MPPOOL_GRAIN 8        ///< digits per size class step
+#endif
+#ifndef MPPOOL_CLASSES
+#define MPPOOL_CLASSES 64     ///< nr. of size classes
+#endif
+#ifndef MPPOOL_DEPTH
+#define MPPOOL_DEPTH 32       ///< max. nr. of free blocks kept per class
+#endif
+/*@}*/
+
+/*
+ * Storage of the pool pointer of a thread, see FPEnv.hh.
+ */
+#if defined(FPENV_TLS_OBJECT)
+#define MPPOOL_TLS thread_local
+#elif defined(FPENV_TLS_POINTER)
+#define MPPOOL_TLS FPENV_TLS_POINTER
+#else
+#define MPPOOL_TLS
+#endif
+
+class MpArena;
+
+/**
+ ** @brief Per-thread cache of significand blocks.
+ **/
+class MpPool {
+
+public:
+  MpPool();
+  ~MpPool();
+
+  /// pool of the calling thread
+  static MpPool& local();
+
+  /**
+   ** @name Allocation
+   **
+   ** release() and dealloc() take the n the block was allocated with.
+   **/
+  /*@{*/
+  static Digit *allocate( unsigned int n );
+  static void release( Digit *d, unsigned int n );
+
+  Digit *alloc( unsigned int n );
+  void dealloc( Digit *d, unsigned int n );
+  void trim();
+  /*@}*/
+
+  /**
+   ** @name Counters
+   **
+   ** A hit is an allocation served from the free blocks, a miss one
+   ** that had to call new.
+   **/
+  /*@{*/
+  unsigned long getHits() const;
+  unsigned long getMisses() const;
+  void resetCounters();
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  Digit *freeBlocks[MPPOOL_CLASSES + 1][MPPOOL_DEPTH];
+  unsigned int nFree[MPPOOL_CLASSES + 1];
+  unsigned long hits;
+  unsigned long misses;
+  Digit *spare[MPPOOL_CLASSES + 1]; // blocks kept for the arenas
+  unsigned int arenas;         // nr. of active arenas
+
+  void releaseSpare();
+  static unsigned int sizeClass( unsigned int n );
+  static Digit *block( unsigned int n );
+  static MpPool*& slot();      // pool of the calling thread, or 0
+  static int& exited();        // pool of the calling thread deleted
+  static void atExit();
+  static void exitThread( void * );
+#ifdef MPTHREADS_PTHREAD
+  static pthread_key_t& exitKey();
+  static void createExitKey();
+#endif
+
+  MpPool( const MpPool& );     // not copyable
+  MpPool& operator=( const MpPool& );
+
+  friend class MpArena;
+};
+
+/**
+ ** @brief Significand block of an MpIeee that came from the MpPool.
+ **
+ ** Default constructed as none, also in constructors that do not
+ ** know it, so a significand is only given back to the pool when it
+ ** is the block recorded here.
+ **/
+class MpPoolBlock {
+
+public:
+  MpPoolBlock();
+
+  Digit *digits;               ///< the block, or 0
+  unsigned int size;           ///< nr. of digits it was allocated with
+};
+
+/**
+ ** @brief Scoped arena for the significands of one computation.
+ **
+ ** While an arena exists, the pool of its thread keeps every
+ ** significand freed, not only MPPOOL_DEPTH per size class, and
+ ** hands them out again; the destructor of the outermost arena
+ ** releases the extra ones all at once.  The significands are
+ ** ordinary pool blocks, so MpIeees that got theirs inside the arena
+ ** can outlive it, and can be released by any thread.  Arenas can be
+ ** nested.
+ **/
+class MpArena {
+
+public:
+  MpArena();
+  ~MpArena();
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  MpPool& pool;
+
+  MpArena( const MpArena& );   // not copyable
+  MpArena& operator=( const MpArena& );
+};
+
+#ifndef OUTLINE
+#include "MpPool.icc"
+#endif
+
+#endif /* _ARITHMOS_MPPOOL_H_ */
@@ -0,0 +1,103 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpRound : Rounding of a digit string into a floating-point format
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpRound.hh
+ ** @brief    Rounding of a digit string into a floating-point format
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** The one rounding step shared by every kernel that computes a result
+ ** beyond the precision of its format: MpAccumulator, MpFusedSum,
+ ** MpSeries, MpDecimal, MpIeeeN, MpIeeeVector, MpDouble and
+ ** MpMultiDouble.  It takes the value as a digit string and the class
+ ** of what lies below it, and does the guard and sticky digits, ties
+ ** to even, the directed modes, denormals, underflow to zero and
+ ** overflow, with the exponent arithmetic in long so that no exponent
+ ** range, the default one included, wraps.
+ **
+ ** This file is included by MpIeee.hh, do not include it directly.
+ **/
+
+/*
+ * Some notes on the rest.
+ *
+ * The digits of the value may stop anywhere: at the last digit of the
+ * result, beyond it, or before it.  What lies below the last digit
+ * given is passed as its class, in units of that digit:
+ *
+ *	0	nothing, the digits are exact
+ *	1	above 0, below one half
+ *	2	exactly one half
+ *	3	above one half, below one
+ *
+ * Kernels that only know whether more nonzero digits follow pass 1 for
+ * a sticky bit; they always give the digits down to the guard digit,
+ * so that the half never needs to be told apart.  MpDecimal and the
+ * hardware kernels stop at the last digit of the result and know the
+ * class exactly, which also covers the ties of an odd radix.
+ */
+
+#ifndef _ARITHMOS_MPROUND_H_
+#define _ARITHMOS_MPROUND_H_
+
+/**
+ ** @brief Rounding of digit strings into floating-point formats.
+ **/
+class MpRound {
+
+public:
+  /**
+   ** @name Rounding
+   **
+   ** round() rounds s 0.w[0]...w[n-1] radix^e, followed by rest, to
+   ** the p digits d[0], d[stride], ... of a format with exponent range
+   ** l..u.  It stores zero as zero digits at exponent l - 1 and, on an
+   ** overflow, the largest number; infinite() tells if the overflow
+   ** is infinity instead, in the representation of the caller.
+   ** store() does the same into a MpIeee.  overflow() and underflow()
+   ** store a result known to be beyond the largest number or below
+   ** half the smallest denormal.  All return the exceptions raised,
+   ** and signal none of them.
+   **/
+  /*@{*/
+  static FP_Excep round( const Digit *w, unsigned long n, long e, sign s,
+			 int rest, unsigned int p, int l, int u,
+			 FP_Rnd rounding, Digit radix, Digit *d,
+			 unsigned int stride, long& exponent );
+  static FP_Excep store( const Digit *w, unsigned long n, long e, sign s,
+			 int rest, FP_Rnd rounding, MpIeee& result );
+  static FP_Excep overflow( sign s, FP_Rnd rounding, MpIeee& result );
+  static FP_Excep underflow( sign s, FP_Rnd rounding, MpIeee& result );
+  static FP_Excep largest( unsigned int p, int u, Digit radix, Digit *d,
+			   unsigned int stride, long& exponent );
+  static int infinite( FP_Rnd rounding, sign s );
+  static int up( FP_Rnd rounding, sign s, int rest, int odd );
+  static int classOf( Digit g, int sticky, Digit radix );
+  static int odd( const Digit *d, unsigned int p, unsigned int stride,
+		  Digit radix );
+  /*@}*/
+};
+
+#ifndef OUTLINE
+#include "MpRound.icc"
+#endif
+
+#endif /* _ARITHMOS_MPROUND_H_ */
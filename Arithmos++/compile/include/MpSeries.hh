@@ -0,0 +1,297 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpSeries : Series evaluation for the elementary functions
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpSeries.hh
+ ** @brief    Series evaluation for the elementary functions
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** The Taylor series of exp, sin, cos, atan, sinh, cosh and their
+ ** relatives, evaluated by rectangular splitting (Paterson and
+ ** Stockmeyer): about 2 sqrt(n) full multiplications for n terms,
+ ** all other work is multiplication and division by small integers.
+ ** The functions reduce their argument by halving or tripling first,
+ ** and undo the reduction afterwards, with a number of steps that
+ ** grows with the precision.  MpIeee::exponential(), sine(),
+ ** cosine(), arctangent(), hyperbolicsine() and hyperboliccosine()
+ ** are built on these.  Above the threshold of MpAgm, the exponential
+ ** is taken from its Newton iteration instead.
+ **/
+
+/*
+ * Some notes on the evaluation.
+ *
+ * All series are of the form S = sum_k a_k y^k with a_0 = 1 and a
+ * ratio a_k / a_{k-1} of small integers.  With the powers y^1 ...
+ * y^m, the terms are summed backwards in blocks of m:
+ *
+ *	B_j = 1 + r_1 (y + r_2 (y^2 + ... r_{m-1} (y^{m-1} +
+ *	      r_m y^m B_{j+1})))
+ *
+ * where r_i is the ratio of term jm + i.  Per block, this is one full
+ * multiplication, by y^m, and m scalings by a ratio and additions of
+ * a precomputed power.  m is about sqrt(n).
+ *
+ * The argument reductions are
+ *
+ *	exp x   = radix^k exp(t)^(2^s),		t = (x - k ln radix) / 2^s
+ *	sin x   = sin 3t = 3 sin t - 4 sin^3 t,	s times, t = x / 3^s
+ *	cos x   = cos 2t = 2 cos^2 t - 1,		s times, t = x / 2^s
+ *	sinh x  = sinh 3t = 3 sinh t + 4 sinh^3 t
+ *	cosh x  = cosh 2t = 2 cosh^2 t - 1
+ *	atan x  = 2 atan( x / (1 + sqrt(1 + x^2)) ),	s times
+ *
+ * after the reduction of sin and cos to [-pi/4, pi/4] and of atan to
+ * [-1, 1].  s is chosen such that |t| < 2^-r, with r the cube root of
+ * the number of bits of the working precision, which balances the
+ * reconstruction against the terms of the series.  Every
+ * reconstruction step costs at most two bits of accuracy; these, and
+ * the guard bits, are added to the working precision.
+ *
+ * The result is rounded after Ziv: the first attempt carries
+ * MPSERIES_GUARD guard bits, and the working result is then within
+ * 2^-guard units in the last place of the result.  If all values in
+ * that interval round to the same number in the rounding mode, that
+ * is the result; otherwise the evaluation is repeated with twice the
+ * guard bits, at most MPSERIES_RETRIES times.  The number of attempts
+ * taken goes to the report function.  The functions have no exact
+ * results for the arguments that get here, so the test fails only
+ * for the rare arguments with a result very close to a rounding
+ * boundary.
+ *
+ * The rounding mode is passed down to the rounding step, and the
+ * exceptions come back in flags; only the functions without a mode
+ * read it from, and signal into, the environment of the thread.  The
+ * working precision and round to nearest are only set in that
+ * environment while an attempt runs, under an FPEnvGuard.
+ */
+
+#ifndef _ARITHMOS_MPSERIES_H_
+#define _ARITHMOS_MPSERIES_H_
+
+#include <MpIeee.hh>
+#include <MpConstants.hh>
+
+#ifndef MPSERIES_GUARD
+#define MPSERIES_GUARD 24     ///< guard bits of the first attempt
+#endif
+
+#ifndef MPSERIES_RETRIES
+#define MPSERIES_RETRIES 8    ///< attempts after the first, each with
+                              ///< twice the guard bits
+#endif
+
+/**
+ ** Series with the ratio of their terms.
+ **/
+typedef enum    MpSeries_Kind {
+  MP_SERIES_EXP   = 0, ///< sum y^k / k!, exp y
+  MP_SERIES_SIN   = 1, ///< sum (-y)^k / (2k+1)!, sin x / x for y = x^2
+  MP_SERIES_COS   = 2, ///< sum (-y)^k / (2k)!, cos x for y = x^2
+  MP_SERIES_SINH  = 3, ///< sum y^k / (2k+1)!, sinh x / x for y = x^2
+  MP_SERIES_COSH  = 4, ///< sum y^k / (2k)!, cosh x for y = x^2
+  MP_SERIES_ATAN  = 5, ///< sum (-y)^k / (2k+1), atan x / x for y = x^2
+  MP_SERIES_ATANH = 6  ///< sum y^k / (2k+1), atanh x / x for y = x^2
+} mp_series_kind;
+
+/**
+ ** Report of an evaluation: the function, the precision of the result
+ ** and the number of retries it took.
+ **/
+typedef void (*mp_series_report)( const char *function, unsigned int prec,
+				  unsigned int retries );
+
+/**
+ ** @brief Rectangular splitting series and elementary functions.
+ **/
+class MpSeries {
+
+public:
+  /**
+   ** @name Elementary functions
+   **
+   ** f(X), rounded to the format of result in the current rounding
+   ** mode, or in the given one with the exceptions added to flags
+   ** instead of signalled.  X and result may be the same MpIeee.
+   **/
+  /*@{*/
+  static MpIeee& exp( const MpIeee& X, MpIeee& result );
+  static MpIeee& sin( const MpIeee& X, MpIeee& result );
+  static MpIeee& cos( const MpIeee& X, MpIeee& result );
+  static MpIeee& atan( const MpIeee& X, MpIeee& result );
+  static MpIeee& sinh( const MpIeee& X, MpIeee& result );
+  static MpIeee& cosh( const MpIeee& X, MpIeee& result );
+  static MpIeee& tanh( const MpIeee& X, MpIeee& result );
+  static MpIeee& exp( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		      FP_Excep& flags );
+  static MpIeee& sin( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		      FP_Excep& flags );
+  static MpIeee& cos( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		      FP_Excep& flags );
+  static MpIeee& atan( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		       FP_Excep& flags );
+  static MpIeee& sinh( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		       FP_Excep& flags );
+  static MpIeee& cosh( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		       FP_Excep& flags );
+  static MpIeee& tanh( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		       FP_Excep& flags );
+  /*@}*/
+
+  /**
+   ** @name Functions of MpIeee
+   **
+   ** f(X) of the MpIeee member f, evaluated with guard digits in the
+   ** environment of the calling thread and rounded after Ziv, in the
+   ** given mode, with the exceptions added to flags.
+   **/
+  /*@{*/
+  static MpIeee& tan( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		      FP_Excep& flags );
+  static MpIeee& cotan( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+			FP_Excep& flags );
+  static MpIeee& asin( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		       FP_Excep& flags );
+  static MpIeee& acos( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+		       FP_Excep& flags );
+  static MpIeee& acotan( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+			 FP_Excep& flags );
+  static MpIeee& arsinh( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+			 FP_Excep& flags );
+  static MpIeee& arcosh( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+			 FP_Excep& flags );
+  static MpIeee& artanh( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+			 FP_Excep& flags );
+  static MpIeee& arcotanh( const MpIeee& X, MpIeee& result, FP_Rnd rounding,
+			   FP_Excep& flags );
+  /*@}*/
+
+  /**
+   ** @name Series
+   **
+   ** result = sum a_k y^k, to about the precision of result, for
+   ** |y| < 1.  Evaluated in the format of result, which should be
+   ** wide enough for the powers of y.
+   **/
+  /*@{*/
+  static MpIeee& evaluate( mp_series_kind kind, const MpIeee& y,
+			   MpIeee& result );
+  static unsigned long terms( mp_series_kind kind, const MpIeee& y,
+			      unsigned int prec );
+  /*@}*/
+
+  /**
+   ** @name Retry report
+   **
+   ** Called after every rounded evaluation; 0, the default, reports
+   ** nothing.  printReport() writes a line to cerr.
+   **/
+  /*@{*/
+  static void setReport( mp_series_report report );
+  static void printReport( const char *function, unsigned int prec,
+			   unsigned int retries );
+  /*@}*/
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  typedef MpIeee *(*Work)( const MpIeee& X, int which, unsigned int prec,
+			   unsigned long guard );
+
+  static unsigned long bits( unsigned int prec );
+  static unsigned int digits( unsigned long bits );
+  static unsigned int working( unsigned int prec, unsigned long guard,
+			       int& r, double log2t, double log2step );
+  static unsigned int steps( const MpIeee& T, int r, double log2step );
+  static double log2Abs( const MpIeee& X );
+  static MpIeee *make( unsigned int prec );
+  static void copy( const MpIeee& X, MpIeee& T );
+
+  static int ratio( mp_series_kind kind, unsigned long k,
+		    unsigned long& num, unsigned long *den );
+  static void mulSmall( MpIeee& X, unsigned long f );
+  static void divSmall( MpIeee& X, unsigned long f );
+  static void mulPow( MpIeee& X, unsigned long f, unsigned int s );
+  static void divPow( MpIeee& X, unsigned long f, unsigned int s );
+  static void setInt( MpIeee& X, long i );
+  static void negate( MpIeee& X );
+  static unsigned int nearest( const MpIeee& X, MpIeee& N );
+
+  static int expBounds( const MpIeee& X, const MpIeee& result );
+  static long expReduce( const MpIeee& X, MpIeee& T );
+  static void expWork( const MpIeee& X, MpIeee& W, int r );
+  static MpIeee *expAt( const MpIeee& X, int which, unsigned int prec,
+			unsigned long guard );
+  static unsigned int trigReduce( const MpIeee& X, MpIeee& T );
+  static void sinWork( MpIeee& T, int r );
+  static void cosWork( MpIeee& T, int r );
+  static MpIeee *trigAt( const MpIeee& X, int cosine, unsigned int prec,
+			 unsigned long guard );
+  static MpIeee *atanAt( const MpIeee& X, int which, unsigned int prec,
+			 unsigned long guard );
+  static void sinhWork( MpIeee& T, int r );
+  static void coshWork( MpIeee& T, int r );
+  static MpIeee *hyperbolicAt( const MpIeee& X, int which, unsigned int prec,
+			       unsigned long guard );
+  static void hyperbolic( const MpIeee& X, MpIeee& result, int which,
+			  FP_Rnd rounding, FP_Excep& flags );
+
+  static mp_series_report& report();
+  static void retried( const char *function, unsigned int prec,
+		       unsigned int retries );
+  static unsigned long first();
+  static int roundable( const MpIeee& W, unsigned long guard,
+			const MpIeee& result, FP_Rnd rounding );
+  static int rounds( const MpIeee& W, const MpIeee& result, FP_Rnd rounding,
+		     unsigned long& guard, unsigned int& retries );
+  static MpIeee& ziv( const char *function, Work work, const MpIeee& X,
+		      int which, MpIeee& result, FP_Rnd rounding,
+		      FP_Excep& flags );
+
+  typedef TmpMpIeee (MpIeee::*Member)();
+
+  static MpIeee *memberAt( const MpIeee& X, int which, unsigned int prec,
+			   unsigned long guard );
+  static MpIeee& rounded( int which, const MpIeee& X, MpIeee& result,
+			  FP_Rnd rounding, FP_Excep& flags );
+
+  static int special( const MpIeee& X, MpIeee& result, int odd );
+  static unsigned int tiny( const MpIeee& X, const MpIeee& result,
+			    int order );
+  static MpIeee& beside( const MpIeee& X, int one, int below,
+			 unsigned int n, MpIeee& result, FP_Rnd rounding,
+			 FP_Excep& flags );
+  static MpIeee& roundTo( const MpIeee& W, MpIeee& result, FP_Rnd rounding,
+			  FP_Excep& flags );
+  static MpIeee& signal( MpIeee& result, FP_Excep flags );
+
+  friend class MpAgm;
+};
+
+#include <MpAgm.hh>
+
+#ifndef OUTLINE
+#include "MpSeries.icc"
+#endif
+
+#endif /* _ARITHMOS_MPSERIES_H_ */
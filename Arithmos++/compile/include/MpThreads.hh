@@ -0,0 +1,163 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpThreads : Threads, mutexes and condition variables
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpThreads.hh
+ ** @brief    Threads, mutexes and condition variables
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** A thin layer over POSIX threads, or Win32 threads with
+ ** _WINDOWS_MSVC_, for the parts of the library that share data
+ ** between threads.  With ARITHMOS_NO_THREADS the classes do nothing.
+ **/
+
+#ifndef _ARITHMOS_MPTHREADS_H_
+#define _ARITHMOS_MPTHREADS_H_
+
+#ifndef ARITHMOS_NO_THREADS
+#if defined(_WINDOWS_MSVC_)
+#define MPTHREADS_WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION mp_mutex;
+typedef CONDITION_VARIABLE mp_cond;
+#else
+#define MPTHREADS_PTHREAD
+#include <pthread.h>
+#include <unistd.h>
+typedef pthread_mutex_t mp_mutex;
+typedef pthread_cond_t mp_cond;
+#endif
+#endif
+
+/**
+ ** @brief Mutex.
+ **/
+class MpMutex {
+
+public:
+  MpMutex();
+  ~MpMutex();
+
+  void acquire();
+  void release();
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+#if defined(MPTHREADS_PTHREAD) || defined(MPTHREADS_WIN32)
+  mp_mutex m;
+#endif
+
+  MpMutex( const MpMutex& );   // not copyable
+  MpMutex& operator=( const MpMutex& );
+
+  friend class MpCondition;
+};
+
+/**
+ ** @brief Holds a mutex for the lifetime of the object.
+ **/
+class MpLock {
+
+public:
+  MpLock( MpMutex& mutex );
+  ~MpLock();
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  MpMutex& m;
+
+  MpLock( const MpLock& );     // not copyable
+  MpLock& operator=( const MpLock& );
+};
+
+/**
+ ** @brief Condition variable.
+ **/
+class MpCondition {
+
+public:
+  MpCondition();
+  ~MpCondition();
+
+  void wait( MpMutex& mutex );  ///< mutex must be held
+  void wakeAll();
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+#if defined(MPTHREADS_PTHREAD) || defined(MPTHREADS_WIN32)
+  mp_cond c;
+#endif
+
+  MpCondition( const MpCondition& );   // not copyable
+  MpCondition& operator=( const MpCondition& );
+};
+
+/**
+ ** @brief Thread that runs one function and is then joined.
+ **
+ ** If no thread can be started, start() runs the function in the
+ ** calling thread.
+ **/
+class MpThread {
+
+public:
+  MpThread();
+  ~MpThread();                  ///< joins the thread
+
+  void start( void (*function)( void * ), void *argument );
+  void join();
+
+#ifndef _WINDOWS_MSVC_
+private:
+#else
+protected:
+#endif
+  void (*fn)( void * );
+  void *arg;
+  int running;
+#if defined(MPTHREADS_PTHREAD)
+  pthread_t thread;
+
+  static void *entry( void *t );
+#elif defined(MPTHREADS_WIN32)
+  HANDLE thread;
+
+  static DWORD WINAPI entry( LPVOID t );
+#endif
+
+  MpThread( const MpThread& );   // not copyable
+  MpThread& operator=( const MpThread& );
+};
+
+#ifndef OUTLINE
+#include "MpThreads.icc"
+#endif
+
+#endif /* _ARITHMOS_MPTHREADS_H_ */
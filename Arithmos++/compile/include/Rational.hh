@@ -74,6 +74,9 @@ class Rational : public ControlStatus
       Rational( const TmpBigInt& t );
       Rational( const Rational& r );
       Rational( const TmpRational& t );
+#ifdef ARITHMOS_RVALUE_REFS
+      Rational( Rational&& r );
+#endif
       /*@}*/
       ~Rational();
 
@@ -94,6 +97,9 @@ class Rational : public ControlStatus
   Rational& operator=( const TmpBigInt& t );
   Rational& operator=( const Rational& b );
   Rational& operator=( const TmpRational& t );
+#ifdef ARITHMOS_RVALUE_REFS
+  Rational& operator=( Rational&& r );
+#endif
   Rational& set( const TmpBigInt& num, const TmpBigInt& den );
   /*@}*/
 
@@ -181,16 +187,32 @@ class Rational : public ControlStatus
   Rational& operator+= ( const Rational& b );
   friend TmpRational operator+( const Rational& a, const
 				Rational& b );
+  friend TmpRational operator+( const TmpRational& a, const
+				Rational& b );
+  friend TmpRational operator+( const Rational& a, const
+				TmpRational& b );
+  friend TmpRational operator+( const TmpRational& a, const
+				TmpRational& b );
   Rational& operator-= ( const Rational& b );
   friend TmpRational operator-( const Rational& a, const
 				Rational& b );
+  friend TmpRational operator-( const TmpRational& a, const
+				Rational& b );
   friend TmpRational operator-( const Rational& b );
   Rational& operator*= ( const Rational& b );
   friend TmpRational operator*( const Rational& a, const
 				Rational& b );
+  friend TmpRational operator*( const TmpRational& a, const
+				Rational& b );
+  friend TmpRational operator*( const Rational& a, const
+				TmpRational& b );
+  friend TmpRational operator*( const TmpRational& a, const
+				TmpRational& b );
   Rational& operator/= ( const Rational& b );
   friend TmpRational operator/( const Rational& a, const
 				Rational& b );
+  friend TmpRational operator/( const TmpRational& a, const
+				Rational& b );
   TmpRational sqrt() const;
   TmpRational inv() const;
   
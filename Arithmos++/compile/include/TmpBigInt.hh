@@ -69,6 +69,10 @@ class TmpBigInt : public BigInt
       TmpBigInt( const BigInt& b ) : BigInt( b ) {}
       TmpBigInt( const TmpBigInt& t ) : BigInt( t ) {}
       TmpBigInt( const MpIeee& m ) : BigInt( m ) {}
+#ifdef ARITHMOS_RVALUE_REFS
+      TmpBigInt( BigInt&& b ) : BigInt( std::move( b ) ) {}
+      TmpBigInt( TmpBigInt&& t ) : BigInt( std::move( t ) ) {}
+#endif
       /*@}*/
 
       /**
@@ -36,6 +36,10 @@ public:
   /*@{*/
   TmpCMpIeee ( const TmpCMpIeee& t ); // assumption initializer
   TmpCMpIeee ( const CMpIeee& y ); // verbatim copy
+#ifdef ARITHMOS_RVALUE_REFS
+  TmpCMpIeee ( CMpIeee&& y ) : CMpIeee( std::move( y ) ) {}
+  TmpCMpIeee ( TmpCMpIeee&& t ) : CMpIeee( std::move( t ) ) {}
+#endif
   /*@}*/
 
   // destructor
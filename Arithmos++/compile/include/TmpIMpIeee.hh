@@ -61,6 +61,10 @@ class TmpIMpIeee : public IMpIeee {
   TmpIMpIeee( const IMpIeee& R );
   TmpIMpIeee( const TmpIMpIeee& T );
   TmpIMpIeee( SpecialValue s );
+#ifdef ARITHMOS_RVALUE_REFS
+  TmpIMpIeee( IMpIeee&& R ) : IMpIeee( std::move( R ) ) {}
+  TmpIMpIeee( TmpIMpIeee&& T ) : IMpIeee( std::move( T ) ) {}
+#endif
 
   ~TmpIMpIeee() {}
   void operator= ( const IMpIeee& R );
@@ -71,6 +71,10 @@ public:
   TmpMpIeee( SpecialRounded s, unsigned int prec, int l, int u );
   TmpMpIeee( const MpIeee& R );
   TmpMpIeee( const TmpMpIeee& T );
+#ifdef ARITHMOS_RVALUE_REFS
+  TmpMpIeee( MpIeee&& R ) : MpIeee( std::move( R ) ) {}
+  TmpMpIeee( TmpMpIeee&& T ) : MpIeee( std::move( T ) ) {}
+#endif
   /*@}*/
   
   /// destructor
@@ -82,6 +86,9 @@ public:
   /*@{*/
   void operator=(const MpIeee &R);
   void operator=(TmpMpIeee &T);
+#ifdef ARITHMOS_RVALUE_REFS
+  void operator=(MpIeee &&R) { MpIeee::operator=( std::move( R ) ); }
+#endif
   /*@}*/
 
   // auxiliary routines
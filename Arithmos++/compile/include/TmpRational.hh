@@ -68,6 +68,10 @@ class TmpRational : public Rational
       TmpRational( const TmpBigInt& t ) : Rational( t ) {}
       TmpRational( const Rational& r ) : Rational( r ) {}
       TmpRational( const TmpRational& t ) : Rational( t ) {}
+#ifdef ARITHMOS_RVALUE_REFS
+      TmpRational( Rational&& r ) : Rational( std::move( r ) ) {}
+      TmpRational( TmpRational&& t ) : Rational( std::move( t ) ) {}
+#endif
       /*@}*/
 
       /**
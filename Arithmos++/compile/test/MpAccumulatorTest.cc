@@ -0,0 +1,180 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpAccumulatorTest : Regression test of the exact accumulator in the
+ **                     default exponent range
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpAccumulatorTest.cc
+ ** @brief    Regression test of the exact accumulator in the default
+ **           exponent range
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** Adds terms and products of the default format, whose exponent range
+ ** is nearly that of an int, into default MpAccumulators.  A register
+ ** covering the whole format once made these fail to allocate.  The
+ ** terms lie far apart, cancel exactly, underflow and overflow, and
+ ** are read in every rounding mode.  Link with the Arithmos library;
+ ** the exit status is the number of mismatches.
+ **/
+
+#include <MpAccumulator.hh>
+#include <stdio.h>
+
+static const FP_Rnd modes[] = { FP_RN, FP_RZ, FP_RP, FP_RM };
+
+/**
+ ** @return	radix^e in the default format
+ **/
+static MpIeee power( long e )
+{
+  MpIeee x( 1 );
+
+  x.setExp( e + 1 );
+  return x;
+}
+
+/**
+ ** @return	1 and a message if the test failed
+ **/
+static int report( const char *name, int ok )
+{
+  printf( "%-32s %s\n", name, ok ? "ok" : "FAILED" );
+  return !ok;
+}
+
+/**
+ ** @brief	Terms 2 10^5 digits apart, cancelling exactly.
+ **/
+static int farApart()
+{
+  MpAccumulator A;
+  MpIeee r;
+  FP_Excep flags = 0;
+
+  A.add( power( 100000 ) );
+  A.add( power( -100000 ) );
+  A.sub( power( 100000 ) );
+  A.roundTo( r, FP_RN, flags );
+  return report( "far apart", r == power( -100000 ) && flags == 0 );
+}
+
+/**
+ ** @brief	1 - radix^-100000 in every rounding mode.
+ **/
+static int directed()
+{
+  MpIeee one( 1 ), below( 1 ), r;
+  int bad = 0;
+
+  MpIeee::sub( one, power( -(long) one.prec() ), below );
+  for (int m = 0; m < 4; m++) {
+    MpAccumulator A;
+    FP_Excep flags = 0;
+
+    A.addProduct( power( 100000 ), power( -100000 ) );
+    A.subProduct( power( -50000 ), power( -50000 ) );
+    A.roundTo( r, modes[m], flags );
+    bad += (r != ((modes[m] == FP_RN || modes[m] == FP_RP) ? one : below)) ||
+      flags != FP_INX;
+  }
+  return report( "directed rounding", bad == 0 );
+}
+
+/**
+ ** @brief	The square of the smallest normal number.
+ **/
+static int underflow()
+{
+  MpIeee m = power( (long) MpIeee().getL() - 1 ), r;
+  int bad = 0;
+
+  for (int k = 0; k < 4; k++) {
+    MpAccumulator A;
+    FP_Excep flags = 0;
+
+    A.addProduct( m, m );
+    A.roundTo( r, modes[k], flags );
+    if (flags != (FP_UFL | FP_INX))
+      bad++;
+    else if (modes[k] == FP_RP)
+      bad += r.isZero() || r.getExp() != r.getL() || r.getSign() != plus;
+    else
+      bad += !r.isZero();
+  }
+  return report( "underflow to denormal or zero", bad == 0 );
+}
+
+/**
+ ** @brief	The square of a number near the largest one.
+ **/
+static int overflow()
+{
+  MpIeee m = power( (long) MpIeee().getU() - 1 ), r;
+  int bad = 0;
+
+  for (int k = 0; k < 4; k++) {
+    MpAccumulator A;
+    FP_Excep flags = 0;
+
+    A.subProduct( m, m );
+    A.roundTo( r, modes[k], flags );
+    if (flags != (FP_OFL | FP_INX) || r.getSign() != minus)
+      bad++;
+    else if (modes[k] == FP_RN || modes[k] == FP_RM)
+      bad += !r.isInf();
+    else
+      bad += r.isInf() || r.getExp() != r.getU();
+  }
+  return report( "overflow to infinity or largest", bad == 0 );
+}
+
+/**
+ ** @brief	Accumulators added into each other, and copied.
+ **/
+static int merged()
+{
+  MpAccumulator A, B;
+  MpIeee r, twice;
+  FP_Excep flags = 0;
+
+  A.add( power( 70000 ) );
+  B.add( power( -70000 ) );
+  A.add( B );
+  B = A;
+  MpAccumulator C( B );
+  C.add( A );
+  C.sub( power( 70000 ) );
+  C.sub( power( 70000 ) );
+  C.roundTo( r, FP_RN, flags );
+  MpIeee::add( power( -70000 ), power( -70000 ), twice );
+  return report( "merged and copied", r == twice && flags == 0 );
+}
+
+int main()
+{
+  int bad = 0;
+
+  bad += farApart();
+  bad += directed();
+  bad += underflow();
+  bad += overflow();
+  bad += merged();
+  return bad;
+}
@@ -0,0 +1,348 @@
+/******************************************************************************
+ **
+ ** Arithmos class library
+ **
+ ** MpMultiDoubleTest : Regression test of the double-double and
+ **                     quad-double kernels
+ **
+ ** Copyright (C) 2000
+ ** Research Group Computer Arithmetic & Numerical Techniques (CANT)
+ ** Department of Mathematics & Computer Science
+ ** University of Antwerp
+ ** Universiteitsplein 1
+ ** B-2610 Wilrijk
+ ** BELGIUM
+ **
+ ** contact : cant@uia.ua.ac.be
+ **
+ ******************************************************************************/
+
+/**
+ ** @file     MpMultiDoubleTest.cc
+ ** @brief    Regression test of the double-double and quad-double kernels
+ **
+ ** $Id$
+ ** $Date$
+ ** $Author$
+ **
+ ** Multiplies, divides and takes square roots of digit strings with the
+ ** MpMultiDouble kernels, and compares the rounded digits, exponent,
+ ** sign and exceptions with those of the exact result of the digit
+ ** kernels, rounded by MpRound.  The operands are random, lie halfway
+ ** when multiplied, or are all ones, whose remainders cancel to a few
+ ** units and once threw the estimates of the kernels off so far that
+ ** the correction never ended.  Their exponents lie at the ends of the
+ ** default exponent range, which is nearly that of an int, so that
+ ** results overflow, become denormal and underflow to zero, in every
+ ** rounding mode.  MpRound itself is checked first against results
+ ** worked out by hand.
+ **
+ ** Only the kernels are used, which are all in the headers, so the
+ ** Arithmos library is not needed.  The headers do emit the unused
+ ** vtable of ControlStatus, which refers into the library; the linker
+ ** drops it with
+ **
+ **	c++ -ffunction-sections -fdata-sections -Wl,--gc-sections
+ **	    -I../include MpMultiDoubleTest.cc
+ **
+ ** The exit status is the number of mismatches.
+ **/
+
+#include <MpIeee.hh>
+#include <limits.h>
+#include <stdio.h>
+
+#define MAXPREC 212             ///< max. nr. of digits of a format
+
+static const FP_Rnd modes[] = { FP_RN, FP_RZ, FP_RP, FP_RM };
+
+/**
+ ** @name	The exponent range of the default format
+ **/
+/*@{*/
+static const int defaultL = INT_MIN + 2;
+static const int defaultU = INT_MAX - 1;
+/*@}*/
+
+/**
+ ** @return	1 and a message if the test failed
+ **/
+static int report( const char *name, int ok )
+{
+  printf( "%-32s %s\n", name, ok ? "ok" : "FAILED" );
+  return !ok;
+}
+
+/**
+ ** @return	pseudo-random bits, the same on every platform
+ **/
+static unsigned long randomBits( unsigned int bits )
+{
+  static unsigned long x = 1;
+
+  x = (x * 1103515245UL + 12345UL) & 0x7fffffffUL;
+  return x >> (31 - bits);
+}
+
+/*
+ * MpRound
+ */
+
+/**
+ ** @brief	Round s 0.w radix^e, w decimal digits followed by rest,
+ **		to 3 decimal digits with exponents l..u.
+ ** @return	nonzero if that gives the digits, exponent and exceptions
+ **		expected
+ **/
+static int rounds( const char *w, long e, sign s, int rest,
+		   FP_Rnd rounding, int l, int u, const char *digits,
+		   long exponent, FP_Excep flags )
+{
+  Digit in[16], d[3];
+  unsigned long n;
+  long x;
+
+  for (n = 0; w[n]; n++)
+    in[n] = (Digit) (w[n] - '0');
+
+  FP_Excep f = MpRound::round( in, n, e, s, rest, 3, l, u, rounding, 10, d,
+			       1, x );
+
+  for (int i = 0; i < 3; i++)
+    if (d[i] != (Digit) (digits[i] - '0'))
+      return 0;
+  return x == exponent && f == flags;
+}
+
+/**
+ ** @brief	The four rounding modes, ties and carries.
+ **/
+static int roundingModes()
+{
+  int ok = 1;
+
+  ok &= rounds( "1234", 0, plus, 0, FP_RN, -9, 9, "123", 0, FP_INX );
+  ok &= rounds( "1234", 0, plus, 0, FP_RZ, -9, 9, "123", 0, FP_INX );
+  ok &= rounds( "1234", 0, plus, 0, FP_RP, -9, 9, "124", 0, FP_INX );
+  ok &= rounds( "1234", 0, plus, 0, FP_RM, -9, 9, "123", 0, FP_INX );
+  ok &= rounds( "1234", 0, minus, 0, FP_RP, -9, 9, "123", 0, FP_INX );
+  ok &= rounds( "1234", 0, minus, 0, FP_RM, -9, 9, "124", 0, FP_INX );
+  ok &= rounds( "1236", 0, plus, 0, FP_RN, -9, 9, "124", 0, FP_INX );
+  ok &= rounds( "1235", 0, plus, 0, FP_RN, -9, 9, "124", 0, FP_INX );
+  ok &= rounds( "1245", 0, plus, 0, FP_RN, -9, 9, "124", 0, FP_INX );
+  ok &= rounds( "1245", 0, plus, 1, FP_RN, -9, 9, "125", 0, FP_INX );
+  ok &= rounds( "123", 0, plus, 2, FP_RN, -9, 9, "124", 0, FP_INX );
+  ok &= rounds( "124", 0, plus, 2, FP_RN, -9, 9, "124", 0, FP_INX );
+  ok &= rounds( "124", 0, plus, 3, FP_RN, -9, 9, "125", 0, FP_INX );
+  ok &= rounds( "124", 0, plus, 1, FP_RZ, -9, 9, "124", 0, FP_INX );
+  ok &= rounds( "9995", 4, plus, 0, FP_RN, -9, 9, "100", 5, FP_INX );
+  ok &= rounds( "9991", 4, minus, 0, FP_RM, -9, 9, "100", 5, FP_INX );
+  ok &= rounds( "12300", 2, plus, 0, FP_RP, -9, 9, "123", 2, 0 );
+  ok &= rounds( "00123", 2, plus, 0, FP_RN, -9, 9, "123", 0, 0 );
+  return report( "MpRound: rounding modes", ok );
+}
+
+/**
+ ** @brief	Overflow, denormals and underflow at the ends of the
+ **		default exponent range, with exponents beyond an int.
+ **/
+static int defaultRange()
+{
+  const int l = defaultL, u = defaultU;
+  int ok = 1;
+
+  ok &= rounds( "9995", u, plus, 0, FP_RN, l, u, "999", u,
+		FP_OFL | FP_INX );
+  ok &= rounds( "1", (long) u + 1, minus, 0, FP_RZ, l, u, "999", u,
+		FP_OFL | FP_INX );
+  ok &= rounds( "9994", u, plus, 0, FP_RN, l, u, "999", u, FP_INX );
+  ok &= MpRound::infinite( FP_RN, plus ) && MpRound::infinite( FP_RM, minus )
+    && !MpRound::infinite( FP_RZ, plus ) && !MpRound::infinite( FP_RP, minus );
+
+  ok &= rounds( "1", (long) l - 2, plus, 0, FP_RN, l, u, "001", l, 0 );
+  ok &= rounds( "123", (long) l - 2, plus, 0, FP_RN, l, u, "001", l,
+		FP_UFL | FP_INX );
+  ok &= rounds( "123", (long) l - 2, plus, 0, FP_RP, l, u, "002", l,
+		FP_UFL | FP_INX );
+  ok &= rounds( "999", (long) l - 1, plus, 0, FP_RN, l, u, "100", l,
+		FP_UFL | FP_INX );
+  ok &= rounds( "5", (long) l - 3, plus, 0, FP_RN, l, u, "000", (long) l - 1,
+		FP_UFL | FP_INX );
+  ok &= rounds( "6", (long) l - 3, plus, 0, FP_RN, l, u, "001", l,
+		FP_UFL | FP_INX );
+  ok &= rounds( "1", (long) l - 100000, plus, 0, FP_RN, l, u, "000",
+		(long) l - 1, FP_UFL | FP_INX );
+  ok &= rounds( "1", (long) l - 100000, minus, 0, FP_RM, l, u, "001", l,
+		FP_UFL | FP_INX );
+  ok &= rounds( "000", 0, plus, 0, FP_RN, l, u, "000", (long) l - 1, 0 );
+  return report( "MpRound: default exponent range", ok );
+}
+
+/*
+ * MpMultiDouble
+ */
+
+/**
+ ** @brief	Round x * y, x / y or sqrt( x ) with the MpMultiDouble
+ **		kernels and with the digit kernels.
+ ** @param	op '*', '/' or 'q' for the square root
+ ** @param	unsettled counts the quotients and roots the kernels
+ **		left to the digit kernels
+ ** @return	nonzero if both give the same
+ **/
+static int agrees( char op, const Digit *x, int ex, const Digit *y, int ey,
+		   sign s, unsigned int b, unsigned int p, FP_Rnd rounding,
+		   int& unsettled )
+{
+  const int l = defaultL, u = defaultU;
+  double fx[4], fy[4];
+  long gx, gy;
+  int nx = MpMultiDouble::unpack( x, 1, p, ex, b, fx, gx );
+  int ny = MpMultiDouble::unpack( y, 1, p, ey, b, fy, gy );
+  MpMultiDouble::Exact r;
+  Digit d[MAXPREC];
+  int exponent, settled = 1;
+  sign sd;
+
+  if (op == '*')
+    MpMultiDouble::product( fx, nx, gx, fy, ny, gy, s, b * p, r );
+  else if (op == '/')
+    settled = MpMultiDouble::quotient( fx, nx, gx, fy, ny, gy, s, b * p, r );
+  else
+    settled = MpMultiDouble::root( fx, nx, gx, b * p, r );
+  if (!settled) {
+    unsettled++;
+    return 1;
+  }
+
+  FP_Excep f = MpMultiDouble::round( r, b, p, l, u, rounding, d, 1,
+				     exponent, sd );
+
+  /*
+   * The exact result as 0.w radix^e, with the sticky bit of what the
+   * digits leave out; x and y are integers X and Y of p digits.
+   */
+  Digit radix = (Digit) (1UL << b);
+  Digit w[2 * MAXPREC + 8], q[MAXPREC + 8], rest[MAXPREC + 8];
+  Digit ref[MAXPREC];
+  unsigned long n;
+  long e0;
+  int sticky = 0;
+  unsigned int i;
+
+  if (op == '*') {
+    MpDigits::mul( w, x, p, y, p, radix );
+    n = 2 * p;
+    e0 = (long) ex + ey;
+  }
+  else if (op == '/') {
+    /*
+     * floor( X radix^(p+2) / Y ) has at least p + 2 digits.
+     */
+    MpDigits::copy( w, x, p );
+    MpDigits::zero( w + p, p + 2 );
+    MpDigits::divRem( q, rest, w, 2 * p + 2, y, p, radix );
+    for (i = 0; i < p && !sticky; i++)
+      sticky = (rest[i] != 0);
+    MpDigits::copy( w, q, p + 3 );
+    n = p + 3;
+    e0 = (long) ex - ey + 1;
+  }
+  else {
+    /*
+     * sqrt( X radix^(ex-p) ) = sqrt( X radix^t ) radix^((ex-p-t)/2),
+     * with X radix^t in 2m digits.
+     */
+    long t = (long) p + 4 + (((long) ex - (long) p - (long) p - 4) & 1);
+    unsigned int m = (unsigned int) ((p + t + 1) / 2);
+    Digit a[2 * MAXPREC + 16];
+
+    MpDigits::zero( a, 2 * m );
+    MpDigits::copy( a + 2 * m - p - t, x, p );
+    MpDigits::sqrtRem( w, rest, a, m, radix );
+    for (i = 0; i <= m && !sticky; i++)
+      sticky = (rest[i] != 0);
+    n = m;
+    e0 = (long) m + ((long) ex - (long) p - t) / 2;
+  }
+
+  long ee;
+  FP_Excep g = MpRound::round( w, n, e0, s, sticky, p, l, u, rounding, radix,
+			       ref, 1, ee );
+
+  for (i = 0; i < p; i++)
+    if (d[i] != ref[i])
+      return 0;
+  return exponent == (int) ee && sd == s && f == g;
+}
+
+/**
+ ** @return	nr. of results of one format that differ between the
+ **		kernels
+ **/
+static int check( unsigned int b, unsigned int p )
+{
+  const int l = defaultL, u = defaultU;
+  const int exponents[][2] = {
+    { 0, 0 }, { 3, -2 }, { -1, 1 }, { u, 1 }, { u, -1 }, { u - 1, 2 },
+    { u / 2 + 1, u / 2 }, { l, -1 }, { l, 1 }, { l, -2 },
+    { l + 1, -(int) (p / 2) }, { l, -(int) p - 2 }, { l / 2, l / 2 + 1 },
+    { l / 2, l / 2 }
+  };
+  const unsigned int pairs = sizeof( exponents ) / sizeof( exponents[0] );
+  Digit x[MAXPREC], y[MAXPREC];
+  int bad = 0, unsettled = 0;
+  char name[64];
+
+  for (int k = 0; k < 41; k++) {
+    for (unsigned int i = 0; i < p; i++) {
+      x[i] = (k == 0) ? (Digit) ((1UL << b) - 1) : (Digit) randomBits( b );
+      y[i] = (k == 0) ? x[i] : (Digit) randomBits( b );
+    }
+    x[0] = x[0] ? x[0] : 1;
+    y[0] = y[0] ? y[0] : 1;
+    if (k == 1) {
+      /*
+       * y = 3/4: x * y often lies halfway.
+       */
+      MpDigits::zero( y, p );
+      if (b == 1)
+	y[0] = y[1] = 1;
+      else
+	y[0] = (Digit) (3UL << (b - 2));
+    }
+    for (unsigned int j = 0; j < pairs; j++) {
+      int ex = exponents[j][0], ey = exponents[j][1];
+      sign s = randomBits( 1 ) ? minus : plus;
+
+      for (int m = 0; m < 4; m++) {
+	bad += !agrees( '*', x, ex, y, ey, s, b, p, modes[m], unsettled );
+	bad += !agrees( '/', x, ex, y, ey, s, b, p, modes[m], unsettled );
+	bad += !agrees( 'q', x, ex, y, ey, plus, b, p, modes[m], unsettled );
+      }
+    }
+  }
+  sprintf( name, "radix 2^%u, prec %u", b, p );
+  if (unsettled)
+    printf( "%-32s %d left to the digit kernels\n", name, unsettled );
+  return report( name, bad == 0 );
+}
+
+int main()
+{
+  int bad = 0;
+
+  bad += roundingModes();
+  bad += defaultRange();
+  bad += check( 1, 54 );
+  bad += check( 1, 106 );
+  bad += check( 1, 107 );
+  bad += check( 1, 160 );
+  bad += check( 1, 212 );
+  bad += check( 24, 3 );
+  bad += check( 24, 8 );
+  bad += check( 16, 4 );
+  bad += check( 16, 13 );
+  bad += check( 8, 20 );
+  return bad;
+}